@@ -87,6 +87,7 @@ int phannot_parse_annotations(zval *result, zval *comment, zval *file_path, zval
 	int comment_len;
 	char *file_path_str;
 	int line_num;
+	zend_string *cache_key;
 
 	char *error_msg = NULL;
 
@@ -112,7 +113,18 @@ int phannot_parse_annotations(zval *result, zval *comment, zval *file_path, zval
 		line_num = 0;
 	}
 
+	cache_key = phalcon_parsers_cache_key(PHALCON_PARSERS_CACHE_ANNOTATIONS, comment_str, comment_len, file_path_str, line_num);
+
+	if (cache_key && phalcon_parsers_cache_find(result, cache_key) == SUCCESS) {
+		zend_string_release(cache_key);
+		return SUCCESS;
+	}
+
 	if (phannot_internal_parse_annotations(&result, comment_str, comment_len, file_path_str, line_num, &error_msg TSRMLS_CC) == FAILURE) {
+		if (cache_key) {
+			zend_string_release(cache_key);
+		}
+
 		if (likely(error_msg != NULL)) {
 			zephir_throw_exception_string(phalcon_annotations_exception_ce, error_msg, strlen(error_msg) TSRMLS_CC);
 			efree(error_msg);
@@ -123,6 +135,11 @@ int phannot_parse_annotations(zval *result, zval *comment, zval *file_path, zval
 		return FAILURE;
 	}
 
+	if (cache_key) {
+		phalcon_parsers_cache_store(cache_key, result);
+		zend_string_release(cache_key);
+	}
+
 	return SUCCESS;
 }
 
@@ -11,6 +11,8 @@
 #include "scanner.h"
 #include "annot.h"
 
+#include "phalcon/parsers/cache.h"
+
 #include "kernel/main.h"
 #include "kernel/exception.h"
 
@@ -0,0 +1,259 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+
+#include <ext/standard/html.h>
+#include <zend_smart_str.h>
+
+#include "phalcon/escaper/fast.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PHALCON_ESCAPER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * Returns the offset of the first byte htmlspecialchars() could change, or
+ * the length of the string. Bytes above 0x7F stop the scan because they have
+ * to be validated against the charset
+ */
+static size_t phalcon_escaper_html_scan(const unsigned char *str, size_t length)
+{
+	size_t pos = 0;
+
+#ifdef PHALCON_ESCAPER_SSE2
+	const __m128i amp = _mm_set1_epi8('&');
+	const __m128i lt = _mm_set1_epi8('<');
+	const __m128i gt = _mm_set1_epi8('>');
+	const __m128i dquote = _mm_set1_epi8('"');
+	const __m128i squote = _mm_set1_epi8('\'');
+	__m128i chunk, found;
+
+	while (pos + 16 <= length) {
+		chunk = _mm_loadu_si128((const __m128i *) (str + pos));
+		found = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, amp), _mm_cmpeq_epi8(chunk, lt)),
+			_mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(chunk, gt), _mm_cmpeq_epi8(chunk, dquote)),
+				_mm_cmpeq_epi8(chunk, squote)
+			)
+		);
+
+		/* The sign bit of the chunk itself flags the non ASCII bytes */
+		if (_mm_movemask_epi8(_mm_or_si128(found, chunk))) {
+			break;
+		}
+
+		pos += 16;
+	}
+#endif
+
+	while (pos < length) {
+		switch (str[pos]) {
+			case '&':
+			case '<':
+			case '>':
+			case '"':
+			case '\'':
+				return pos;
+		}
+
+		if (str[pos] >= 0x80) {
+			return pos;
+		}
+
+		pos++;
+	}
+
+	return pos;
+}
+
+void phalcon_escape_html_fast(zval *return_value, zval *text, zval *quote_type, zval *encoding, zval *double_encode)
+{
+	zend_string *str, *escaped;
+	zend_long flags = zval_get_long(quote_type);
+	const char *charset = NULL;
+
+	str = zval_get_string(text);
+
+	/**
+	 * ENT_DISALLOWED can replace ASCII control characters, so those strings
+	 * always go through htmlspecialchars()
+	 */
+	if (!(flags & ENT_DISALLOWED) && phalcon_escaper_html_scan((const unsigned char *) ZSTR_VAL(str), ZSTR_LEN(str)) == ZSTR_LEN(str)) {
+		RETURN_STR(str);
+	}
+
+	if (Z_TYPE_P(encoding) == IS_STRING) {
+		charset = Z_STRVAL_P(encoding);
+	}
+
+#if PHP_VERSION_ID >= 80000
+	escaped = php_escape_html_entities_ex((const unsigned char *) ZSTR_VAL(str), ZSTR_LEN(str), 0, (int) flags, charset, zend_is_true(double_encode), 0);
+#else
+	escaped = php_escape_html_entities_ex((unsigned char *) ZSTR_VAL(str), ZSTR_LEN(str), 0, (int) flags, (char *) charset, zend_is_true(double_encode));
+#endif
+
+	zend_string_release(str);
+	RETURN_NEW_STR(escaped);
+}
+
+/**
+ * Alphanumeric characters and, for JavaScript, the whitelist of
+ * zephir_escape_multi() are not escaped
+ */
+static zend_always_inline int phalcon_escaper_is_safe(unsigned char ch, int use_whitelist)
+{
+	if ((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z')) {
+		return 1;
+	}
+
+	if (use_whitelist && ch != '\0') {
+		return strchr(" /*+-\t\n^$!?\\#}{)(][.,:;_|", ch) != NULL;
+	}
+
+	return 0;
+}
+
+/**
+ * Decodes the UTF-8 sequence at str, returning its length or 0 when it is
+ * invalid, overlong or a surrogate
+ */
+static size_t phalcon_escaper_utf8_decode(const unsigned char *str, size_t length, zend_ulong *codepoint)
+{
+	size_t size, i;
+	zend_ulong value;
+
+	if (str[0] >= 0xF0 && str[0] <= 0xF4) {
+		size = 4;
+		value = str[0] & 0x07;
+	} else if (str[0] >= 0xE0) {
+		size = 3;
+		value = str[0] & 0x0F;
+	} else if (str[0] >= 0xC2 && str[0] <= 0xDF) {
+		size = 2;
+		value = str[0] & 0x1F;
+	} else {
+		return 0;
+	}
+
+	if (size > length) {
+		return 0;
+	}
+
+	for (i = 1; i < size; i++) {
+		if ((str[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+
+		value = (value << 6) | (str[i] & 0x3F);
+	}
+
+	if ((size == 3 && (value < 0x800 || (value >= 0xD800 && value <= 0xDFFF))) ||
+		(size == 4 && (value < 0x10000 || value > 0x10FFFF))) {
+		return 0;
+	}
+
+	*codepoint = value;
+
+	return size;
+}
+
+/**
+ * Escapes a UTF-8 string like zephir_escape_multi() does with its UTF-32
+ * version. Strings without characters to escape are returned as they are.
+ * Returns false for empty strings, NUL bytes and invalid UTF-8, which are
+ * left to the UTF-32 path
+ */
+static void phalcon_escaper_hex(zval *return_value, zval *param, const char *prefix, size_t prefix_length, char suffix, int use_whitelist)
+{
+	static const char digits[] = "0123456789abcdef";
+	const unsigned char *str, *end;
+	smart_str buffer = {0};
+	zend_ulong codepoint;
+	char hex[8], *ptr;
+	size_t size;
+
+	if (Z_TYPE_P(param) != IS_STRING || Z_STRLEN_P(param) == 0) {
+		RETURN_FALSE;
+	}
+
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	end = str + Z_STRLEN_P(param);
+
+	while (str < end && phalcon_escaper_is_safe(*str, use_whitelist)) {
+		str++;
+	}
+
+	if (str == end) {
+		RETURN_STR_COPY(Z_STR_P(param));
+	}
+
+	smart_str_alloc(&buffer, Z_STRLEN_P(param) * 2, 0);
+	smart_str_appendl(&buffer, Z_STRVAL_P(param), (const char *) str - Z_STRVAL_P(param));
+
+	while (str < end) {
+		if (*str < 0x80) {
+			if (*str == '\0') {
+				smart_str_free(&buffer);
+				RETURN_FALSE;
+			}
+
+			if (phalcon_escaper_is_safe(*str, use_whitelist)) {
+				smart_str_appendc(&buffer, (char) *str);
+				str++;
+				continue;
+			}
+
+			codepoint = *str;
+			size = 1;
+		} else {
+			size = phalcon_escaper_utf8_decode(str, end - str, &codepoint);
+
+			if (!size) {
+				smart_str_free(&buffer);
+				RETURN_FALSE;
+			}
+		}
+
+		ptr = hex + sizeof(hex);
+		do {
+			*--ptr = digits[codepoint & 0x0F];
+			codepoint >>= 4;
+		} while (codepoint);
+
+		smart_str_appendl(&buffer, prefix, prefix_length);
+		smart_str_appendl(&buffer, ptr, hex + sizeof(hex) - ptr);
+		if (suffix != '\0') {
+			smart_str_appendc(&buffer, suffix);
+		}
+
+		str += size;
+	}
+
+	smart_str_0(&buffer);
+	RETURN_NEW_STR(buffer.s);
+}
+
+void phalcon_escape_js_fast(zval *return_value, zval *param)
+{
+	phalcon_escaper_hex(return_value, param, "\\x", sizeof("\\x") - 1, '\0', 1);
+}
+
+void phalcon_escape_css_fast(zval *return_value, zval *param)
+{
+	phalcon_escaper_hex(return_value, param, "\\", sizeof("\\") - 1, ' ', 0);
+}
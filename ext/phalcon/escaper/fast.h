@@ -0,0 +1,22 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_ESCAPER_FAST_H
+#define PHALCON_ESCAPER_FAST_H
+
+#include <Zend/zend.h>
+
+/* Works like htmlspecialchars(), returning the same string when nothing has to be escaped */
+void phalcon_escape_html_fast(zval *return_value, zval *text, zval *quote_type, zval *encoding, zval *double_encode);
+
+/* Escape UTF-8 strings directly, returning false when the input needs the UTF-32 path */
+void phalcon_escape_js_fast(zval *return_value, zval *param);
+void phalcon_escape_css_fast(zval *return_value, zval *param);
+
+#endif /* PHALCON_ESCAPER_FAST_H */
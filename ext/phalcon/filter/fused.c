@@ -0,0 +1,329 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+
+#include <ext/standard/php_string.h>
+#include <zend_smart_str.h>
+
+#include "phalcon/filter/fused.h"
+
+/**
+ * Returns a string that can be modified in place
+ */
+static zend_string *phalcon_filter_separate(zend_string *str)
+{
+	zend_string *copy;
+
+	if (!ZSTR_IS_INTERNED(str) && GC_REFCOUNT(str) == 1) {
+		zend_string_forget_hash_val(str);
+		return str;
+	}
+
+	copy = zend_string_init(ZSTR_VAL(str), ZSTR_LEN(str), 0);
+	zend_string_release(str);
+
+	return copy;
+}
+
+static void phalcon_filter_set_length(zend_string *str, size_t length)
+{
+	ZSTR_LEN(str) = length;
+	ZSTR_VAL(str)[length] = '\0';
+}
+
+/**
+ * trim() with the default character list
+ */
+static void phalcon_filter_op_trim(zend_string *str)
+{
+	const char *value = ZSTR_VAL(str);
+	size_t start = 0, end = ZSTR_LEN(str);
+	char ch;
+
+	while (start < end) {
+		ch = value[start];
+		if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r' && ch != '\v' && ch != '\0') {
+			break;
+		}
+		start++;
+	}
+
+	while (end > start) {
+		ch = value[end - 1];
+		if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r' && ch != '\v' && ch != '\0') {
+			break;
+		}
+		end--;
+	}
+
+	if (start > 0) {
+		memmove(ZSTR_VAL(str), ZSTR_VAL(str) + start, end - start);
+	}
+
+	phalcon_filter_set_length(str, end - start);
+}
+
+/**
+ * Lower/Upper. ASCII strings are converted in place, anything else goes
+ * through mb_convert_case() exactly like the sanitizers do
+ */
+static int phalcon_filter_op_case(zend_string **str, int upper)
+{
+	unsigned char *cursor = (unsigned char *) ZSTR_VAL(*str);
+	unsigned char *end = cursor + ZSTR_LEN(*str);
+	zval function_name, params[3], result;
+
+	while (cursor < end && *cursor < 0x80) {
+		cursor++;
+	}
+
+	if (cursor == end) {
+		cursor = (unsigned char *) ZSTR_VAL(*str);
+		while (cursor < end) {
+			if (upper) {
+				if (*cursor >= 'a' && *cursor <= 'z') {
+					*cursor -= 32;
+				}
+			} else if (*cursor >= 'A' && *cursor <= 'Z') {
+				*cursor += 32;
+			}
+			cursor++;
+		}
+
+		return SUCCESS;
+	}
+
+	/**
+	 * Without mbstring the sanitizers use utf8_decode(); let them do it
+	 */
+	if (!zend_hash_str_exists(EG(function_table), "mb_convert_case", sizeof("mb_convert_case") - 1)) {
+		return FAILURE;
+	}
+
+	ZVAL_STRINGL(&function_name, "mb_convert_case", sizeof("mb_convert_case") - 1);
+	ZVAL_STR(&params[0], *str);
+	ZVAL_LONG(&params[1], upper ? 0 : 1); /* MB_CASE_UPPER, MB_CASE_LOWER */
+	ZVAL_STRINGL(&params[2], "UTF-8", sizeof("UTF-8") - 1);
+	ZVAL_UNDEF(&result);
+
+	if (call_user_function(EG(function_table), NULL, &function_name, &result, 3, params) == FAILURE || Z_TYPE(result) != IS_STRING) {
+		zval_ptr_dtor(&function_name);
+		zval_ptr_dtor(&params[2]);
+		zval_ptr_dtor(&result);
+		return FAILURE;
+	}
+
+	zval_ptr_dtor(&function_name);
+	zval_ptr_dtor(&params[0]);
+	zval_ptr_dtor(&params[2]);
+
+	*str = phalcon_filter_separate(Z_STR(result));
+
+	return SUCCESS;
+}
+
+/**
+ * preg_replace("/[^A-Za-z0-9]/", "", input)
+ */
+static void phalcon_filter_op_alnum(zend_string *str)
+{
+	char *read = ZSTR_VAL(str), *write = ZSTR_VAL(str);
+	char *end = read + ZSTR_LEN(str);
+
+	while (read < end) {
+		if ((*read >= 'a' && *read <= 'z') || (*read >= 'A' && *read <= 'Z') || (*read >= '0' && *read <= '9')) {
+			*write++ = *read;
+		}
+		read++;
+	}
+
+	phalcon_filter_set_length(str, write - ZSTR_VAL(str));
+}
+
+/**
+ * strip_tags() without allowed tags
+ */
+static void phalcon_filter_op_striptags(zend_string *str)
+{
+	size_t length;
+
+#if PHP_VERSION_ID >= 70400
+	length = php_strip_tags(ZSTR_VAL(str), ZSTR_LEN(str), NULL, 0);
+#else
+	length = php_strip_tags(ZSTR_VAL(str), ZSTR_LEN(str), NULL, NULL, 0);
+#endif
+
+	phalcon_filter_set_length(str, length);
+}
+
+/**
+ * filter_var(input, FILTER_SANITIZE_SPECIAL_CHARS): ' " < > & and the
+ * characters below 32 become numeric entities
+ */
+static zend_string *phalcon_filter_op_special(zend_string *str)
+{
+	unsigned char *cursor = (unsigned char *) ZSTR_VAL(str);
+	unsigned char *end = cursor + ZSTR_LEN(str);
+	smart_str escaped = {0};
+
+	while (cursor < end) {
+		if (*cursor < 32 || *cursor == '\'' || *cursor == '"' || *cursor == '<' || *cursor == '>' || *cursor == '&') {
+			break;
+		}
+		cursor++;
+	}
+
+	/* Nothing to encode */
+	if (cursor == end) {
+		return str;
+	}
+
+	smart_str_appendl(&escaped, ZSTR_VAL(str), (char *) cursor - ZSTR_VAL(str));
+
+	while (cursor < end) {
+		if (*cursor < 32 || *cursor == '\'' || *cursor == '"' || *cursor == '<' || *cursor == '>' || *cursor == '&') {
+			smart_str_appendl(&escaped, "&#", 2);
+			smart_str_append_unsigned(&escaped, (zend_ulong) *cursor);
+			smart_str_appendc(&escaped, ';');
+		} else {
+			smart_str_appendc(&escaped, *cursor);
+		}
+		cursor++;
+	}
+
+	smart_str_0(&escaped);
+	zend_string_release(str);
+
+	return escaped.s;
+}
+
+/**
+ * (int) filter_var(input, FILTER_SANITIZE_NUMBER_INT)
+ */
+static zend_long phalcon_filter_op_int(zend_string *str)
+{
+	char *read = ZSTR_VAL(str), *write = ZSTR_VAL(str);
+	char *end = read + ZSTR_LEN(str);
+	zval number;
+
+	while (read < end) {
+		if ((*read >= '0' && *read <= '9') || *read == '+' || *read == '-') {
+			*write++ = *read;
+		}
+		read++;
+	}
+
+	phalcon_filter_set_length(str, write - ZSTR_VAL(str));
+
+	ZVAL_STR(&number, str);
+
+	return zval_get_long(&number);
+}
+
+static int phalcon_filter_fused_string(zval *return_value, zend_string *input, zval *ops)
+{
+	zend_string *str = zend_string_init(ZSTR_VAL(input), ZSTR_LEN(input), 0);
+	zend_long number;
+	zval *op;
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(ops), op) {
+		switch (zval_get_long(op)) {
+
+			case PHALCON_FILTER_OP_TRIM:
+				phalcon_filter_op_trim(str);
+				break;
+
+			case PHALCON_FILTER_OP_LOWER:
+			case PHALCON_FILTER_OP_UPPER:
+				if (phalcon_filter_op_case(&str, zval_get_long(op) == PHALCON_FILTER_OP_UPPER) == FAILURE) {
+					zend_string_release(str);
+					return FAILURE;
+				}
+				break;
+
+			case PHALCON_FILTER_OP_ALNUM:
+				phalcon_filter_op_alnum(str);
+				break;
+
+			case PHALCON_FILTER_OP_STRIPTAGS:
+				phalcon_filter_op_striptags(str);
+				break;
+
+			case PHALCON_FILTER_OP_SPECIAL:
+				str = phalcon_filter_op_special(str);
+				break;
+
+			/* Always the last one, the result is no longer a string */
+			case PHALCON_FILTER_OP_INT:
+				number = phalcon_filter_op_int(str);
+				zend_string_release(str);
+				RETVAL_LONG(number);
+				return SUCCESS;
+
+			default:
+				zend_string_release(str);
+				return FAILURE;
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	RETVAL_STR(str);
+
+	return SUCCESS;
+}
+
+/**
+ * Applies a chain of sanitizers to a string or to every element of an array
+ * of strings in a single call. Returns false if the value cannot be handled
+ * here, the caller then falls back to the sanitizer objects
+ */
+void phalcon_filter_fused(zval *return_value, zval *value, zval *ops)
+{
+	zend_string *key;
+	zend_ulong index;
+	zval *item, sanitized;
+
+	if (Z_TYPE_P(ops) != IS_ARRAY) {
+		RETURN_FALSE;
+	}
+
+	if (Z_TYPE_P(value) == IS_STRING) {
+		if (phalcon_filter_fused_string(return_value, Z_STR_P(value), ops) == FAILURE) {
+			RETURN_FALSE;
+		}
+		return;
+	}
+
+	if (Z_TYPE_P(value) != IS_ARRAY) {
+		RETURN_FALSE;
+	}
+
+	array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(value)));
+
+	ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(value), index, key, item) {
+		ZVAL_DEREF(item);
+
+		if (Z_TYPE_P(item) != IS_STRING || phalcon_filter_fused_string(&sanitized, Z_STR_P(item), ops) == FAILURE) {
+			zval_ptr_dtor(return_value);
+			RETURN_FALSE;
+		}
+
+		if (key) {
+			zend_hash_update(Z_ARRVAL_P(return_value), key, &sanitized);
+		} else {
+			zend_hash_index_update(Z_ARRVAL_P(return_value), index, &sanitized);
+		}
+	} ZEND_HASH_FOREACH_END();
+}
@@ -0,0 +1,28 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_FILTER_FUSED_H
+#define PHALCON_FILTER_FUSED_H
+
+#include <Zend/zend.h>
+
+/* Keep in sync with the OP_* constants of Phalcon\Filter\Pipeline */
+#define PHALCON_FILTER_OP_TRIM      1
+#define PHALCON_FILTER_OP_LOWER     2
+#define PHALCON_FILTER_OP_UPPER     3
+#define PHALCON_FILTER_OP_INT       4
+#define PHALCON_FILTER_OP_ALNUM     5
+#define PHALCON_FILTER_OP_STRIPTAGS 6
+#define PHALCON_FILTER_OP_SPECIAL   7
+
+/* Applies a chain of sanitizers to a string or an array of strings */
+void phalcon_filter_fused(zval *return_value, zval *value, zval *ops);
+
+#endif /* PHALCON_FILTER_FUSED_H */
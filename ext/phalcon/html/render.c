@@ -0,0 +1,239 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+
+#include <ext/standard/html.h>
+#include <zend_smart_str.h>
+
+#include "phalcon/html/render.h"
+
+/* Flags used by htmlspecialchars() when none are passed */
+#if PHP_VERSION_ID >= 80100
+#define PHALCON_HTML_DEFAULT_FLAGS (ENT_QUOTES | ENT_SUBSTITUTE | ENT_HTML401)
+#else
+#define PHALCON_HTML_DEFAULT_FLAGS (ENT_COMPAT | ENT_HTML401)
+#endif
+
+/* Estimated size of a rendered attribute or option */
+#define PHALCON_HTML_ITEM_SIZE 32
+
+/**
+ * Appends a string escaped like htmlspecialchars(). ASCII strings without
+ * special characters are the common case and are copied without calling it
+ */
+static void phalcon_html_append_escaped(smart_str *buffer, zend_string *str, int flags, const char *charset, zend_bool double_encode)
+{
+	const unsigned char *cursor = (const unsigned char *) ZSTR_VAL(str);
+	const unsigned char *end = cursor + ZSTR_LEN(str);
+	zend_string *escaped;
+
+	while (cursor < end) {
+		if (*cursor >= 0x80 || *cursor == '&' || *cursor == '<' || *cursor == '>' || *cursor == '"' || *cursor == '\'') {
+			break;
+		}
+
+		cursor++;
+	}
+
+	if (cursor == end) {
+		smart_str_append(buffer, str);
+		return;
+	}
+
+#if PHP_VERSION_ID >= 80000
+	escaped = php_escape_html_entities_ex((const unsigned char *) ZSTR_VAL(str), ZSTR_LEN(str), 0, flags, charset, double_encode, 0);
+#else
+	escaped = php_escape_html_entities_ex((unsigned char *) ZSTR_VAL(str), ZSTR_LEN(str), 0, flags, (char *) charset, double_encode);
+#endif
+
+	smart_str_append(buffer, escaped);
+	zend_string_release(escaped);
+}
+
+static void phalcon_html_return_buffer(zval *return_value, smart_str *buffer)
+{
+	if (!buffer->s) {
+		RETURN_EMPTY_STRING();
+	}
+
+	smart_str_0(buffer);
+	RETURN_NEW_STR(buffer->s);
+}
+
+/**
+ * Renders the attributes in one buffer. Attributes with a numeric key or a
+ * null value are skipped. Returns false when a value is not a scalar, so
+ * that the caller reports it or converts it
+ */
+void phalcon_html_render_attributes(zval *return_value, zval *attributes, zval *encoding, zval *double_encode)
+{
+	smart_str buffer = {0};
+	zend_string *key, *str;
+	const char *charset = NULL;
+	zend_bool encode = 1;
+	zval *value;
+
+	if (Z_TYPE_P(attributes) != IS_ARRAY) {
+		RETURN_FALSE;
+	}
+
+	if (encoding && Z_TYPE_P(encoding) == IS_STRING) {
+		charset = Z_STRVAL_P(encoding);
+	}
+
+	if (double_encode) {
+		encode = zend_is_true(double_encode);
+	}
+
+	smart_str_alloc(&buffer, zend_hash_num_elements(Z_ARRVAL_P(attributes)) * PHALCON_HTML_ITEM_SIZE, 0);
+
+	ZEND_HASH_FOREACH_STR_KEY_VAL(Z_ARRVAL_P(attributes), key, value) {
+		if (!key) {
+			continue;
+		}
+
+		ZVAL_DEREF(value);
+
+		switch (Z_TYPE_P(value)) {
+			case IS_NULL:
+				continue;
+
+			case IS_ARRAY:
+			case IS_OBJECT:
+			case IS_RESOURCE:
+				smart_str_free(&buffer);
+				RETURN_FALSE;
+
+			default:
+				break;
+		}
+
+		str = zval_get_string(value);
+
+		smart_str_appendc(&buffer, ' ');
+		smart_str_append(&buffer, key);
+		smart_str_appendl(&buffer, "=\"", sizeof("=\"") - 1);
+		phalcon_html_append_escaped(&buffer, str, ENT_QUOTES, charset, encode);
+		smart_str_appendc(&buffer, '"');
+
+		zend_string_release(str);
+	} ZEND_HASH_FOREACH_END();
+
+	phalcon_html_return_buffer(return_value, &buffer);
+}
+
+/**
+ * Checks whether an option is selected: loose in_array() for an array of
+ * values, string comparison otherwise
+ */
+static zend_bool phalcon_html_is_selected(zval *option_value, zend_string *option_str, zval *value, zend_string *value_str)
+{
+	zval *item;
+
+	if (!value_str) {
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(value), item) {
+			if (fast_equal_check_function(option_value, item)) {
+				return 1;
+			}
+		} ZEND_HASH_FOREACH_END();
+
+		return 0;
+	}
+
+	return zend_string_equals(option_str, value_str);
+}
+
+static void phalcon_html_options(smart_str *buffer, HashTable *data, zval *value, zend_string *value_str, zend_string *close)
+{
+	zend_string *key, *option_str, *text;
+	zval *option_text, option_value;
+	zend_ulong index;
+
+	ZEND_HASH_FOREACH_KEY_VAL(data, index, key, option_text) {
+		if (key) {
+			ZVAL_STR(&option_value, key);
+			option_str = zend_string_copy(key);
+		} else {
+			ZVAL_LONG(&option_value, index);
+			option_str = zval_get_string(&option_value);
+		}
+
+		ZVAL_DEREF(option_text);
+
+		if (Z_TYPE_P(option_text) == IS_ARRAY) {
+			smart_str_appends(buffer, "\t<optgroup label=\"");
+			phalcon_html_append_escaped(buffer, option_str, PHALCON_HTML_DEFAULT_FLAGS, NULL, 1);
+			smart_str_appends(buffer, "\">" PHP_EOL);
+			phalcon_html_options(buffer, Z_ARRVAL_P(option_text), value, value_str, close);
+			smart_str_appends(buffer, "\t</optgroup>" PHP_EOL);
+
+			zend_string_release(option_str);
+			continue;
+		}
+
+		if (phalcon_html_is_selected(&option_value, option_str, value, value_str)) {
+			smart_str_appends(buffer, "\t<option selected=\"selected\" value=\"");
+		} else {
+			smart_str_appends(buffer, "\t<option value=\"");
+		}
+
+		phalcon_html_append_escaped(buffer, option_str, PHALCON_HTML_DEFAULT_FLAGS, NULL, 1);
+		smart_str_appendl(buffer, "\">", sizeof("\">") - 1);
+
+		text = zval_get_string(option_text);
+		smart_str_append(buffer, text);
+		zend_string_release(text);
+
+		smart_str_append(buffer, close);
+
+		zend_string_release(option_str);
+	} ZEND_HASH_FOREACH_END();
+}
+
+/**
+ * Renders the options of Phalcon\Tag\Select from an array. The values are
+ * escaped like htmlspecialchars() with its default flags, the texts are
+ * rendered as they are
+ */
+void phalcon_html_render_options(zval *return_value, zval *data, zval *value, zval *close_option)
+{
+	smart_str buffer = {0};
+	zend_string *value_str = NULL, *close;
+
+	if (Z_TYPE_P(data) != IS_ARRAY) {
+		RETURN_EMPTY_STRING();
+	}
+
+	ZVAL_DEREF(value);
+
+	if (Z_TYPE_P(value) != IS_ARRAY) {
+		value_str = zval_get_string(value);
+	}
+
+	close = zval_get_string(close_option);
+
+	smart_str_alloc(&buffer, zend_hash_num_elements(Z_ARRVAL_P(data)) * PHALCON_HTML_ITEM_SIZE, 0);
+
+	phalcon_html_options(&buffer, Z_ARRVAL_P(data), value, value_str, close);
+
+	zend_string_release(close);
+
+	if (value_str) {
+		zend_string_release(value_str);
+	}
+
+	phalcon_html_return_buffer(return_value, &buffer);
+}
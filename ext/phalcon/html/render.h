@@ -0,0 +1,21 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_HTML_RENDER_H
+#define PHALCON_HTML_RENDER_H
+
+#include <Zend/zend.h>
+
+/* Renders ' name="value"' for every attribute, escaped like escapeHtmlAttr() */
+void phalcon_html_render_attributes(zval *return_value, zval *attributes, zval *encoding, zval *double_encode);
+
+/* Renders the <option> (and <optgroup>) elements of an array of values */
+void phalcon_html_render_options(zval *return_value, zval *data, zval *value, zval *close_option);
+
+#endif /* PHALCON_HTML_RENDER_H */
@@ -2637,15 +2637,44 @@ static void phql_scanner_error_msg(phql_parser_status *parser_status, zval **err
  */
 int phql_parse_phql(zval *result, zval *phql TSRMLS_DC)
 {
+	zend_phalcon_globals *phalcon_globals_ptr = ZEPHIR_VGLOBAL;
 	zval err_msg, *error_msg = &err_msg;
+	zend_string *cache_key = NULL;
 	ZVAL_UNDEF(error_msg);
 	ZVAL_NULL(result);
 
+	/**
+	 * The process cache is only used when the ASTs are cached per request
+	 */
+	if (phalcon_globals_ptr->orm.cache_level >= 0) {
+		cache_key = phalcon_parsers_cache_key(PHALCON_PARSERS_CACHE_PHQL, Z_STRVAL_P(phql), Z_STRLEN_P(phql), NULL, 0);
+		if (cache_key && phalcon_parsers_cache_find(result, cache_key) == SUCCESS) {
+			zend_string_release(cache_key);
+			return SUCCESS;
+		}
+	}
+
 	if (phql_internal_parse_phql(&result, Z_STRVAL_P(phql), Z_STRLEN_P(phql), &error_msg TSRMLS_CC) == FAILURE) {
+		if (cache_key) {
+			zend_string_release(cache_key);
+		}
 		ZEPHIR_THROW_EXCEPTION_STRW(phalcon_mvc_model_exception_ce, Z_STRVAL_P(error_msg));
 		return FAILURE;
 	}
 
+	if (cache_key) {
+		/**
+		 * The ids given per request start again on every request
+		 */
+		if (Z_TYPE_P(result) == IS_ARRAY && zend_hash_str_exists(Z_ARRVAL_P(result), SL("id"))) {
+			SEPARATE_ARRAY(result);
+			add_assoc_long(result, "id", phalcon_parsers_cache_next_id());
+		}
+
+		phalcon_parsers_cache_store(cache_key, result);
+		zend_string_release(cache_key);
+	}
+
 	return SUCCESS;
 }
 
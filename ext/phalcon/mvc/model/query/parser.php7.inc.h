@@ -11,6 +11,8 @@
 #include "scanner.h"
 #include "phql.h"
 
+#include "phalcon/parsers/cache.h"
+
 #include "kernel/main.h"
 #include "kernel/memory.h"
 #include "kernel/fcall.h"
@@ -3295,6 +3295,7 @@ static void phvolt_scanner_error_msg(phvolt_parser_status *parser_status, zval *
 int phvolt_parse_view(zval *result, zval *view_code, zval *template_path TSRMLS_DC)
 {
 	zval em, *error_msg = &em;
+	zend_string *cache_key;
 	ZVAL_NULL(result);
 	ZVAL_NULL(error_msg);
 
@@ -3303,12 +3304,33 @@ int phvolt_parse_view(zval *result, zval *view_code, zval *template_path TSRMLS_
 		return FAILURE;
 	}
 
+	cache_key = phalcon_parsers_cache_key(
+		PHALCON_PARSERS_CACHE_VOLT,
+		Z_STRVAL_P(view_code),
+		Z_STRLEN_P(view_code),
+		Z_TYPE_P(template_path) == IS_STRING ? Z_STRVAL_P(template_path) : NULL,
+		0
+	);
+
+	if (cache_key && phalcon_parsers_cache_find(result, cache_key) == SUCCESS) {
+		zend_string_release(cache_key);
+		return SUCCESS;
+	}
+
 	if (phvolt_internal_parse_view(&result, view_code, template_path, &error_msg TSRMLS_CC) == FAILURE) {
+		if (cache_key) {
+			zend_string_release(cache_key);
+		}
 		ZEPHIR_THROW_EXCEPTION_STRW(phalcon_mvc_view_exception_ce, Z_STRVAL_P(error_msg));
 		zval_dtor(error_msg);
 		return FAILURE;
 	}
 
+	if (cache_key) {
+		phalcon_parsers_cache_store(cache_key, result);
+		zend_string_release(cache_key);
+	}
+
 	return SUCCESS;
 }
 /* }}} */
@@ -23,6 +23,8 @@
 #include "scanner.h"
 #include "volt.h"
 
+#include "phalcon/parsers/cache.h"
+
 #include "kernel/main.h"
 #include "kernel/memory.h"
 #include "kernel/fcall.h"
@@ -0,0 +1,403 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "php_ini.h"
+
+#include <zend_smart_str.h>
+
+#include "phalcon/parsers/cache.h"
+
+/**
+ * The cache lives in the process, so it is only available in NTS builds of
+ * PHP 7.3 or greater, where arrays and strings can be marked as immutable
+ */
+#if PHP_VERSION_ID >= 70300 && !defined(ZTS)
+#define PHALCON_PARSERS_CACHE_PERSISTENT 1
+#endif
+
+#ifdef PHALCON_PARSERS_CACHE_PERSISTENT
+
+typedef struct _phalcon_parsers_cache_entry {
+	zend_string *key;
+	zval value;
+	size_t size;
+	struct _phalcon_parsers_cache_entry *prev;
+	struct _phalcon_parsers_cache_entry *next;
+} phalcon_parsers_cache_entry;
+
+static zend_bool phalcon_parsers_cache_enabled = 0;
+static zend_bool phalcon_parsers_cache_initialized = 0;
+static size_t phalcon_parsers_cache_limit = 0;
+static size_t phalcon_parsers_cache_bytes = 0;
+static zend_ulong phalcon_parsers_cache_hits = 0;
+static zend_ulong phalcon_parsers_cache_misses = 0;
+static zend_long phalcon_parsers_cache_id = 0;
+
+/* Entries by key, and the least recently used order from head to tail */
+static HashTable phalcon_parsers_cache_table;
+static phalcon_parsers_cache_entry *phalcon_parsers_cache_head = NULL;
+static phalcon_parsers_cache_entry *phalcon_parsers_cache_tail = NULL;
+
+static ZEND_INI_MH(OnUpdateParsersCache)
+{
+	phalcon_parsers_cache_enabled = zend_ini_parse_bool(new_value);
+
+	return SUCCESS;
+}
+
+static ZEND_INI_MH(OnUpdateParsersCacheSize)
+{
+	zend_long limit = zend_atol(ZSTR_VAL(new_value), (int) ZSTR_LEN(new_value));
+
+	phalcon_parsers_cache_limit = limit > 0 ? (size_t) limit : 0;
+
+	return SUCCESS;
+}
+
+PHP_INI_BEGIN()
+	PHP_INI_ENTRY("phalcon.parsers.cache", "0", PHP_INI_SYSTEM, OnUpdateParsersCache)
+	PHP_INI_ENTRY("phalcon.parsers.cache_size", "8M", PHP_INI_SYSTEM, OnUpdateParsersCacheSize)
+PHP_INI_END()
+
+/**
+ * Copies a string to persistent memory, flagged as interned so that the
+ * engine never changes its reference count
+ */
+static zend_string *phalcon_parsers_cache_persist_string(zend_string *str, size_t *size)
+{
+	zend_string *copy = zend_string_init(ZSTR_VAL(str), ZSTR_LEN(str), 1);
+
+	zend_string_hash_val(copy);
+
+	GC_SET_REFCOUNT(copy, 1);
+	GC_TYPE_INFO(copy) = GC_STRING | ((IS_STR_INTERNED | IS_STR_PERSISTENT) << GC_FLAGS_SHIFT);
+
+	*size += ZEND_MM_ALIGNED_SIZE(_ZSTR_STRUCT_SIZE(ZSTR_LEN(str)));
+
+	return copy;
+}
+
+/**
+ * Copies a value to persistent memory as an immutable array. Fails on
+ * objects and resources, which the parsers never produce
+ */
+static int phalcon_parsers_cache_persist(zval *dst, zval *src, size_t *size)
+{
+	HashTable *ht;
+	zend_string *key;
+	zend_ulong index;
+	zval *item, copy;
+	int status = SUCCESS;
+
+	ZVAL_DEREF(src);
+
+	switch (Z_TYPE_P(src)) {
+		case IS_NULL:
+		case IS_FALSE:
+		case IS_TRUE:
+		case IS_LONG:
+		case IS_DOUBLE:
+			ZVAL_COPY_VALUE(dst, src);
+			return SUCCESS;
+
+		case IS_STRING:
+			ZVAL_INTERNED_STR(dst, phalcon_parsers_cache_persist_string(Z_STR_P(src), size));
+			return SUCCESS;
+
+		case IS_ARRAY:
+			ht = pemalloc(sizeof(HashTable), 1);
+			zend_hash_init(ht, zend_hash_num_elements(Z_ARRVAL_P(src)), NULL, NULL, 1);
+
+			ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(src), index, key, item) {
+				status = phalcon_parsers_cache_persist(&copy, item, size);
+
+				if (key) {
+					zend_hash_add_new(ht, phalcon_parsers_cache_persist_string(key, size), &copy);
+				} else {
+					zend_hash_index_add_new(ht, index, &copy);
+				}
+
+				if (status == FAILURE) {
+					break;
+				}
+			} ZEND_HASH_FOREACH_END();
+
+			*size += sizeof(HashTable) + HT_SIZE(ht);
+
+			GC_SET_REFCOUNT(ht, 2);
+			GC_ADD_FLAGS(ht, IS_ARRAY_IMMUTABLE);
+
+			ZVAL_ARR(dst, ht);
+			Z_TYPE_FLAGS_P(dst) = 0;
+			return status;
+	}
+
+	ZVAL_NULL(dst);
+	return FAILURE;
+}
+
+static void phalcon_parsers_cache_free(zval *value)
+{
+	HashTable *ht;
+	Bucket *bucket;
+
+	if (Z_TYPE_P(value) == IS_STRING) {
+		pefree(Z_STR_P(value), 1);
+		return;
+	}
+
+	if (Z_TYPE_P(value) != IS_ARRAY) {
+		return;
+	}
+
+	ht = Z_ARRVAL_P(value);
+
+	ZEND_HASH_FOREACH_BUCKET(ht, bucket) {
+		phalcon_parsers_cache_free(&bucket->val);
+
+		if (bucket->key) {
+			pefree(bucket->key, 1);
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	/* The keys are already freed */
+	HT_FLAGS(ht) |= HASH_FLAG_STATIC_KEYS;
+	GC_SET_REFCOUNT(ht, 1);
+
+	zend_hash_destroy(ht);
+	pefree(ht, 1);
+}
+
+static void phalcon_parsers_cache_unlink(phalcon_parsers_cache_entry *entry)
+{
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		phalcon_parsers_cache_head = entry->next;
+	}
+
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	} else {
+		phalcon_parsers_cache_tail = entry->prev;
+	}
+
+	entry->prev = NULL;
+	entry->next = NULL;
+}
+
+static void phalcon_parsers_cache_link(phalcon_parsers_cache_entry *entry)
+{
+	entry->prev = NULL;
+	entry->next = phalcon_parsers_cache_head;
+
+	if (phalcon_parsers_cache_head) {
+		phalcon_parsers_cache_head->prev = entry;
+	} else {
+		phalcon_parsers_cache_tail = entry;
+	}
+
+	phalcon_parsers_cache_head = entry;
+}
+
+static void phalcon_parsers_cache_evict(phalcon_parsers_cache_entry *entry)
+{
+	phalcon_parsers_cache_unlink(entry);
+	zend_hash_del(&phalcon_parsers_cache_table, entry->key);
+
+	phalcon_parsers_cache_bytes -= entry->size;
+
+	phalcon_parsers_cache_free(&entry->value);
+	pefree(entry->key, 1);
+	pefree(entry, 1);
+}
+
+void phalcon_parsers_cache_init(int module_number)
+{
+	zend_register_ini_entries(ini_entries, module_number);
+
+	zend_hash_init(&phalcon_parsers_cache_table, 64, NULL, NULL, 1);
+	phalcon_parsers_cache_initialized = 1;
+}
+
+void phalcon_parsers_cache_destroy(void)
+{
+	if (!phalcon_parsers_cache_initialized) {
+		return;
+	}
+
+	while (phalcon_parsers_cache_tail) {
+		phalcon_parsers_cache_evict(phalcon_parsers_cache_tail);
+	}
+
+	zend_hash_destroy(&phalcon_parsers_cache_table);
+	phalcon_parsers_cache_initialized = 0;
+}
+
+void phalcon_parsers_cache_stats(zval *return_value)
+{
+	array_init_size(return_value, 6);
+
+	add_assoc_bool(return_value, "enabled", phalcon_parsers_cache_enabled && phalcon_parsers_cache_initialized);
+	add_assoc_long(return_value, "entries", phalcon_parsers_cache_initialized ? zend_hash_num_elements(&phalcon_parsers_cache_table) : 0);
+	add_assoc_long(return_value, "bytes", (zend_long) phalcon_parsers_cache_bytes);
+	add_assoc_long(return_value, "limit", (zend_long) phalcon_parsers_cache_limit);
+	add_assoc_long(return_value, "hits", (zend_long) phalcon_parsers_cache_hits);
+	add_assoc_long(return_value, "misses", (zend_long) phalcon_parsers_cache_misses);
+}
+
+zend_string *phalcon_parsers_cache_key(char type, const char *source, size_t length, const char *file, zend_long line)
+{
+	smart_str key = {0};
+
+	if (!phalcon_parsers_cache_enabled || !phalcon_parsers_cache_initialized) {
+		return NULL;
+	}
+
+	/**
+	 * The file and the line are part of the key because the parsers store
+	 * them in the nodes
+	 */
+	smart_str_appendc(&key, type);
+
+	if (file) {
+		smart_str_appends(&key, file);
+	}
+
+	smart_str_appendc(&key, '\0');
+	smart_str_append_long(&key, line);
+	smart_str_appendc(&key, '\0');
+	smart_str_appendl(&key, source, length);
+	smart_str_0(&key);
+
+	return key.s;
+}
+
+int phalcon_parsers_cache_find(zval *result, zend_string *key)
+{
+	phalcon_parsers_cache_entry *entry;
+
+	entry = zend_hash_find_ptr(&phalcon_parsers_cache_table, key);
+
+	if (!entry) {
+		phalcon_parsers_cache_misses++;
+		return FAILURE;
+	}
+
+	phalcon_parsers_cache_hits++;
+
+	if (entry != phalcon_parsers_cache_head) {
+		phalcon_parsers_cache_unlink(entry);
+		phalcon_parsers_cache_link(entry);
+	}
+
+	ZVAL_COPY_VALUE(result, &entry->value);
+
+	return SUCCESS;
+}
+
+void phalcon_parsers_cache_store(zend_string *key, zval *value)
+{
+	phalcon_parsers_cache_entry *entry;
+	size_t size = sizeof(phalcon_parsers_cache_entry);
+
+	entry = pemalloc(sizeof(phalcon_parsers_cache_entry), 1);
+	entry->prev = NULL;
+	entry->next = NULL;
+
+	if (phalcon_parsers_cache_persist(&entry->value, value, &size) == FAILURE) {
+		phalcon_parsers_cache_free(&entry->value);
+		pefree(entry, 1);
+		return;
+	}
+
+	entry->key = phalcon_parsers_cache_persist_string(key, &size);
+	entry->size = size;
+
+	/**
+	 * Entries bigger than the whole cache are not stored
+	 */
+	if (size > phalcon_parsers_cache_limit || zend_hash_exists(&phalcon_parsers_cache_table, entry->key)) {
+		phalcon_parsers_cache_free(&entry->value);
+		pefree(entry->key, 1);
+		pefree(entry, 1);
+		return;
+	}
+
+	while (phalcon_parsers_cache_tail && phalcon_parsers_cache_bytes + size > phalcon_parsers_cache_limit) {
+		phalcon_parsers_cache_evict(phalcon_parsers_cache_tail);
+	}
+
+	zend_hash_add_new_ptr(&phalcon_parsers_cache_table, entry->key, entry);
+	phalcon_parsers_cache_link(entry);
+
+	phalcon_parsers_cache_bytes += size;
+}
+
+zend_long phalcon_parsers_cache_next_id(void)
+{
+	/* Negative ids never collide with the ones assigned per request */
+	return --phalcon_parsers_cache_id;
+}
+
+#else
+
+PHP_INI_BEGIN()
+	PHP_INI_ENTRY("phalcon.parsers.cache", "0", PHP_INI_SYSTEM, NULL)
+	PHP_INI_ENTRY("phalcon.parsers.cache_size", "8M", PHP_INI_SYSTEM, NULL)
+PHP_INI_END()
+
+void phalcon_parsers_cache_init(int module_number)
+{
+	zend_register_ini_entries(ini_entries, module_number);
+}
+
+void phalcon_parsers_cache_destroy(void)
+{
+}
+
+void phalcon_parsers_cache_stats(zval *return_value)
+{
+	array_init_size(return_value, 6);
+
+	add_assoc_bool(return_value, "enabled", 0);
+	add_assoc_long(return_value, "entries", 0);
+	add_assoc_long(return_value, "bytes", 0);
+	add_assoc_long(return_value, "limit", 0);
+	add_assoc_long(return_value, "hits", 0);
+	add_assoc_long(return_value, "misses", 0);
+}
+
+zend_string *phalcon_parsers_cache_key(char type, const char *source, size_t length, const char *file, zend_long line)
+{
+	return NULL;
+}
+
+int phalcon_parsers_cache_find(zval *result, zend_string *key)
+{
+	return FAILURE;
+}
+
+void phalcon_parsers_cache_store(zend_string *key, zval *value)
+{
+}
+
+zend_long phalcon_parsers_cache_next_id(void)
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,42 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_PARSERS_CACHE_H
+#define PHALCON_PARSERS_CACHE_H
+
+#include <Zend/zend.h>
+
+/* Prefixes of the keys, one per parser */
+#define PHALCON_PARSERS_CACHE_PHQL        'q'
+#define PHALCON_PARSERS_CACHE_VOLT        'v'
+#define PHALCON_PARSERS_CACHE_ANNOTATIONS 'a'
+
+/* Registers the phalcon.parsers.* INI entries */
+void phalcon_parsers_cache_init(int module_number);
+
+/* Frees every entry, called when the module is shut down */
+void phalcon_parsers_cache_destroy(void);
+
+/* Returns the usage of the cache: entries, bytes, limit, hits and misses */
+void phalcon_parsers_cache_stats(zval *return_value);
+
+/* Returns the key of a source or NULL when the cache is disabled */
+zend_string *phalcon_parsers_cache_key(char type, const char *source, size_t length, const char *file, zend_long line);
+
+/* Copies the immutable array stored under the key into result */
+int phalcon_parsers_cache_find(zval *result, zend_string *key);
+
+/* Stores a persistent immutable copy of the value */
+void phalcon_parsers_cache_store(zend_string *key, zval *value);
+
+/* Returns a unique id for the PHQL ASTs shared between requests */
+zend_long phalcon_parsers_cache_next_id(void);
+
+#endif /* PHALCON_PARSERS_CACHE_H */
@@ -12,7 +12,6 @@ namespace Phalcon\Annotations\Adapter;
 
 use Phalcon\Annotations\Reflection;
 use Phalcon\Annotations\Exception;
-use RuntimeException;
 
 /**
  * Stores the parsed annotations in files. This adapter is suitable for production
@@ -51,48 +50,34 @@ class Stream extends AbstractAdapter
     }
 
     /**
-     * Reads parsed annotations from files
+     * Reads parsed annotations from files.
+     *
+     * The files return the raw parsing data as a plain array, so they are
+     * loaded with `require` and kept in shared memory by opcache. The
+     * collections are built lazily by Phalcon\Annotations\Reflection.
+     *
+     * Files written by previous versions hold a serialized Reflection and
+     * are named without the ".annotations" suffix, so they are never
+     * required
      */
     public function read(string key) -> <Reflection> | bool | int
     {
-        var contents;
+        var reflectionData;
         string path;
 
-        /**
-         * Paths must be normalized before be used as keys
-         */
-        let path = this->annotationsDir . prepare_virtual_path(key, "_") . ".php";
+        let path = this->getPath(key);
 
         if !file_exists(path) {
             return false;
         }
 
-        let contents = file_get_contents(path);
+        let reflectionData = require path;
 
-        if unlikely empty contents {
+        if unlikely typeof reflectionData != "array" {
             return false;
         }
 
-        globals_set("warning.enable", false);
-
-        set_error_handler(
-            function (number, message, file, line, context) {
-                globals_set("warning.enable", true);
-            },
-            E_WARNING
-        );
-
-        let contents = unserialize(contents);
-
-        restore_error_handler();
-
-        if unlikely globals_get("warning.enable") {
-            throw new RuntimeException(
-                "Cannot read annotation data"
-            );
-        }
-
-        return contents;
+        return new Reflection(reflectionData);
     }
 
     /**
@@ -101,16 +86,35 @@ class Stream extends AbstractAdapter
     public function write(string! key, <Reflection> data) -> void
     {
         var code;
-        string path;
+        string path, tempPath;
+
+        let path     = this->getPath(key),
+            tempPath = path . "." . uniqid("", true),
+            code     = "<?php return " . var_export(data->getReflectionData(), true) . ";";
 
         /**
-         * Paths must be normalized before be used as keys
+         * The file is renamed once written, so that a concurrent request
+         * never requires a partially written file
          */
-        let path = this->annotationsDir . prepare_virtual_path(key, "_") . ".php",
-            code = serialize(data);
+        if unlikely file_put_contents(tempPath, code) === false {
+            throw new Exception("Annotations directory cannot be written");
+        }
 
-        if unlikely file_put_contents(path, code) === false {
-              throw new Exception("Annotations directory cannot be written");
+        if unlikely !rename(tempPath, path) {
+            unlink(tempPath);
+
+            throw new Exception("Annotations directory cannot be written");
         }
     }
+
+    /**
+     * Returns the file of a key
+     */
+    protected function getPath(string! key) -> string
+    {
+        /**
+         * Paths must be normalized before be used as keys
+         */
+        return this->annotationsDir . prepare_virtual_path(key, "_") . ".annotations.php";
+    }
 }
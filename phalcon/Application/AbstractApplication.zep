@@ -10,10 +10,12 @@
 
 namespace Phalcon\Application;
 
+use Phalcon\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\Injectable;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
+use Phalcon\Tag;
 
 /**
  * Base class for Phalcon\Cli\Console and Phalcon\Mvc\Application.
@@ -119,6 +121,36 @@ abstract class AbstractApplication extends Injectable implements EventsAwareInte
         return this;
     }
 
+    /**
+     * Clears the per request state of the shared services and Phalcon\Tag, so
+     * that a long running worker can bootstrap the application once and
+     * handle many requests with it
+     *
+     * ```php
+     * $application = new Application($container);
+     *
+     * while ($uri = $worker->next()) {
+     *     $application->handle($uri)->send();
+     *
+     *     $application->reset();
+     * }
+     * ```
+     */
+    public function reset() -> <AbstractApplication>
+    {
+        var container;
+
+        let container = this->container;
+
+        if container instanceof Di {
+            container->resetServices();
+        }
+
+        Tag::reset();
+
+        return this;
+    }
+
     /**
      * Sets the module name to be used if the router doesn't return a valid module
      */
@@ -13,6 +13,7 @@ namespace Phalcon;
 use Phalcon\Cache\Adapter\AdapterInterface;
 use Phalcon\Cache\Exception\Exception;
 use Phalcon\Cache\Exception\InvalidArgumentException;
+use Phalcon\Storage\Adapter\AbstractAdapter;
 use Psr\SimpleCache\CacheInterface;
 use Traversable;
 
@@ -149,6 +150,62 @@ class Cache implements CacheInterface
         return this->adapter->has(key);
     }
 
+    /**
+     * Fetches a value from the cache. On a miss the value is calculated by
+     * the callback and stored. Protects against cache stampedes: only one
+     * worker recalculates an item at a time, items can be recalculated before
+     * they expire and stale items can be served while they are refreshed.
+     *
+     * ```php
+     * $value = $cache->remember(
+     *     "heavy-report",
+     *     3600,
+     *     function () {
+     *         return calculateReport();
+     *     },
+     *     [
+     *         "beta"  => 1.0,
+     *         "stale" => 30,
+     *     ]
+     * );
+     * ```
+     *
+     * @param string                 $key      The key of the item
+     * @param null|int|\DateInterval $ttl      The TTL value of this item
+     * @param callable               $callback Calculates the value on a miss
+     * @param array                  $options  See AbstractAdapter::remember()
+     *
+     * @return mixed
+     *
+     * @throws InvalidArgumentException MUST be thrown if the $key string is not a legal value.
+     */
+    public function remember(var key, var ttl, var callback, array options = []) -> var
+    {
+        var value;
+
+        this->checkKey(key);
+
+        if unlikely !is_callable(callback) {
+            throw new InvalidArgumentException(
+                "The callback must be a callable"
+            );
+        }
+
+        if this->adapter instanceof AbstractAdapter {
+            return this->adapter->remember(key, ttl, callback, options);
+        }
+
+        if this->adapter->has(key) {
+            return this->adapter->get(key);
+        }
+
+        let value = call_user_func(callback);
+
+        this->adapter->set(key, value, ttl);
+
+        return value;
+    }
+
     /**
      * Persists data in the cache, uniquely referenced by a key with an optional expiration TTL time.
      *
@@ -122,15 +122,21 @@ class Collection implements
     ) -> var {
         var key, value;
 
-        if likely this->insensitive {
-            let element = element->lower();
-        }
+        /**
+         * Keys are unique regardless of their case, so an exact match is
+         * resolved with a single lookup
+         */
+        if unlikely !fetch value, this->data[element] {
+            if likely this->insensitive {
+                let element = element->lower();
+            }
 
-        if unlikely !fetch key, this->lowerKeys[element] {
-            return defaultValue;
-        }
+            if unlikely !fetch key, this->lowerKeys[element] {
+                return defaultValue;
+            }
 
-        let value = this->data[key];
+            let value = this->data[key];
+        }
 
         if unlikely cast {
             settype(value, cast);
@@ -336,10 +342,17 @@ class Collection implements
      */
     protected function setData(string element, var value) -> void
     {
-        var key;
+        var key, previous;
 
         let key = (true === this->insensitive) ? element->lower() : element;
 
+        /**
+         * The element replaces the one stored with a different case
+         */
+        if fetch previous, this->lowerKeys[key] && previous !== element {
+            unset this->data[previous];
+        }
+
         let this->data[element]  = value,
             this->lowerKeys[key] = element;
     }
@@ -12,6 +12,7 @@ namespace Phalcon;
 
 use Phalcon\Collection;
 use Phalcon\Config\Exception;
+use Traversable;
 
 /**
  * `Phalcon\Config` is designed to simplify the access to, and the use of,
@@ -47,6 +48,61 @@ class Config extends Collection
      */
     protected pathDelimiter = null;
 
+    /**
+     * Keys of the paths already split, per delimiter
+     *
+     * @var array
+     */
+    protected pathKeys = [];
+
+    /**
+     * Get the element from the config. Nested arrays are kept as plain
+     * arrays until they are accessed, then converted to Phalcon\Config
+     */
+    public function get(
+        string element,
+        var defaultValue = null,
+        string! cast = null
+    ) -> var {
+        var key, value;
+
+        if unlikely !fetch value, this->data[element] {
+            if likely this->insensitive {
+                let key = element->lower();
+            } else {
+                let key = element;
+            }
+
+            if unlikely !fetch key, this->lowerKeys[key] {
+                return defaultValue;
+            }
+
+            let element = key,
+                value   = this->data[key];
+        }
+
+        if typeof value === "array" {
+            let value               = new Config(value),
+                this->data[element] = value;
+        }
+
+        if unlikely cast {
+            settype(value, cast);
+        }
+
+        return value;
+    }
+
+    /**
+     * Returns the iterator of the class
+     */
+    public function getIterator() -> <Traversable>
+    {
+        this->materialize();
+
+        return parent::getIterator();
+    }
+
     /**
      * Gets the default path delimiter
      *
@@ -61,6 +117,16 @@ class Config extends Collection
         return this->pathDelimiter;
     }
 
+    /**
+     * Returns the values of the config
+     */
+    public function getValues() -> array
+    {
+        this->materialize();
+
+        return parent::getValues();
+    }
+
     /**
      * Merges a configuration into the current one
      *
@@ -108,6 +174,7 @@ class Config extends Collection
     public function path(string path, defaultValue = null, var delimiter = null)
     {
         var config, key, keys;
+        int index, last;
 
         if this->has(path) {
             return this->get(path);
@@ -117,22 +184,26 @@ class Config extends Collection
             let delimiter = this->getPathDelimiter();
         }
 
-        let config = clone this,
-            keys   = explode(delimiter, path);
+        if unlikely !fetch keys, this->pathKeys[delimiter][path] {
+            let keys                            = explode(delimiter, path),
+                this->pathKeys[delimiter][path] = keys;
+        }
 
-        while (!empty(keys)) {
-            let key = array_shift(keys);
+        let config = this,
+            last   = count(keys) - 1;
 
+        for index, key in keys {
             if !config->has(key) {
                 break;
             }
 
-            if empty(keys) {
+            if index === last {
                 return config->get(key);
             }
 
             let config = config->get(key);
-            if empty(config) {
+
+            if typeof config !== "object" || !(config instanceof Collection) {
                 break;
             }
         }
@@ -199,23 +270,38 @@ class Config extends Collection
     }
 
     /**
-     * Sets the collection data
+     * Converts the nested arrays not accessed yet to Phalcon\Config
+     */
+    protected function materialize() -> void
+    {
+        var key, value;
+
+        for key, value in this->data {
+            if typeof value === "array" {
+                let this->data[key] = new Config(value);
+            }
+        }
+    }
+
+    /**
+     * Sets the collection data. Nested arrays are stored as they are and
+     * converted when accessed
      */
     protected function setData(var element, var value) -> void
     {
-        var data, key;
+        var key, previous;
 
         let element = (string) element,
             key     = (this->insensitive) ? mb_strtolower(element) : element;
 
-        let this->lowerKeys[key] = element;
-
-        if typeof value === "array" {
-            let data = new Config(value);
-        } else {
-            let data = value;
+        /**
+         * The element replaces the one stored with a different case
+         */
+        if fetch previous, this->lowerKeys[key] && previous !== element {
+            unset this->data[previous];
         }
 
-        let this->data[element]  = data;
+        let this->lowerKeys[key] = element,
+            this->data[element]  = value;
     }
 }
@@ -48,16 +48,24 @@ class ConfigFactory extends AbstractFactory
     /**
      * Load a config to create a new instance
      *
+     * When `cacheDir` is set, the final configuration is stored there as a
+     * PHP file returning an array, which opcache keeps in shared memory. The
+     * file is used while the modification times of the sources are unchanged.
+     * A Phalcon\Config is returned instead of the adapter, whether the file
+     * was used or written
+     *
      * @param string|array|\Phalcon\Config config = [
      *      'adapter' => 'ini',
      *      'filePath' => 'config.ini',
      *      'mode' => null,
-     *      'callbacks' => null
+     *      'callbacks' => null,
+     *      'defaultAdapter' => 'php',
+     *      'cacheDir' => null
      * ]
      */
     public function load(config) -> object
     {
-        var adapter, extension, first, oldConfig, second;
+        var adapter, cacheDir, extension, first, oldConfig, second;
 
         if typeof config === "string" {
             let oldConfig = config,
@@ -101,7 +109,7 @@ class ConfigFactory extends AbstractFactory
             first   = config["filePath"],
             second  = null;
 
-        if (empty(pathinfo(first, PATHINFO_EXTENSION))) {
+        if typeof first === "string" && empty(pathinfo(first, PATHINFO_EXTENSION)) {
             let first = first . "." . lcfirst(adapter);
         }
 
@@ -109,6 +117,12 @@ class ConfigFactory extends AbstractFactory
             let second = Arr::get(config, "mode", 1);
         } elseif "yaml" === adapter {
             let second = Arr::get(config, "callbacks", []);
+        } elseif "grouped" === adapter {
+            let second = Arr::get(config, "defaultAdapter", "php");
+        }
+
+        if fetch cacheDir, config["cacheDir"] && cacheDir {
+            return this->loadCached(adapter, first, second, cacheDir);
         }
 
         return this->newInstance(adapter, first, second);
@@ -117,7 +131,7 @@ class ConfigFactory extends AbstractFactory
     /**
      * Returns a new Config instance
      */
-    public function newInstance(string name, string fileName, var params = null) -> object
+    public function newInstance(string name, var fileName, var params = null) -> object
     {
         var definition, options;
 
@@ -147,4 +161,125 @@ class ConfigFactory extends AbstractFactory
             "yaml"    : "Phalcon\\Config\\Adapter\\Yaml"
         ];
     }
+
+    /**
+     * Returns the files a configuration is read from
+     */
+    protected function getSourceFiles(string adapter, var first, var second) -> array
+    {
+        var item, filePath, itemAdapter;
+        array files;
+
+        if typeof first === "string" {
+            return [first];
+        }
+
+        let files = [];
+
+        if "grouped" !== adapter || typeof first !== "array" {
+            return files;
+        }
+
+        for item in first {
+            if typeof item === "string" {
+                let files[] = item;
+
+                continue;
+            }
+
+            if typeof item !== "array" || !fetch filePath, item["filePath"] {
+                continue;
+            }
+
+            if !fetch itemAdapter, item["adapter"] {
+                let itemAdapter = second;
+            }
+
+            let itemAdapter = strtolower(itemAdapter);
+
+            if "array" === itemAdapter {
+                continue;
+            }
+
+            if typeof filePath === "string" && empty(pathinfo(filePath, PATHINFO_EXTENSION)) {
+                let filePath = filePath . "." . lcfirst(itemAdapter);
+            }
+
+            let files = array_merge(
+                files,
+                this->getSourceFiles(itemAdapter, filePath, null)
+            );
+        }
+
+        return files;
+    }
+
+    /**
+     * Returns the configuration stored in the cache directory, or builds it
+     * and stores it there
+     */
+    protected function loadCached(string adapter, var first, var second, string cacheDir) -> <Config>
+    {
+        var cached, cacheFile, config, data, fileName, modified, sources,
+            tempFile;
+        bool fresh;
+
+        let cacheFile = rtrim(cacheDir, "/\\") . DIRECTORY_SEPARATOR . "config-" . md5(
+            serialize(
+                [
+                    adapter,
+                    first,
+                    (typeof second === "array") ? null : second
+                ]
+            )
+        ) . ".php";
+
+        if file_exists(cacheFile) {
+            let cached = require cacheFile;
+
+            if typeof cached === "array" && fetch sources, cached["sources"] {
+                let fresh = true;
+
+                for fileName, modified in sources {
+                    if !file_exists(fileName) || filemtime(fileName) !== modified {
+                        let fresh = false;
+
+                        break;
+                    }
+                }
+
+                if fresh {
+                    return new Config(cached["data"]);
+                }
+            }
+        }
+
+        let config  = this->newInstance(adapter, first, second),
+            sources = [];
+
+        for fileName in this->getSourceFiles(adapter, first, second) {
+            if file_exists(fileName) {
+                let sources[fileName] = filemtime(fileName);
+            }
+        }
+
+        let data     = config->toArray(),
+            tempFile = cacheFile . "." . uniqid("", true);
+
+        if file_put_contents(tempFile, "<?php return " . var_export(["sources" : sources, "data" : data], true) . ";") !== false {
+            if rename(tempFile, cacheFile) {
+                /**
+                 * opcache would keep serving the previous version of the
+                 * file until it revalidates it
+                 */
+                if function_exists("opcache_invalidate") {
+                    opcache_invalidate(cacheFile, true);
+                }
+            } else {
+                unlink(tempFile);
+            }
+        }
+
+        return new Config(data);
+    }
 }
@@ -13,6 +13,7 @@ namespace Phalcon;
 use Phalcon\Crypt\CryptInterface;
 use Phalcon\Crypt\Exception;
 use Phalcon\Crypt\Mismatch;
+use Throwable;
 
 /**
  * Provides encryption capabilities to Phalcon applications.
@@ -75,6 +76,18 @@ class Crypt implements CryptInterface
      */
     protected availableCiphers;
 
+    /**
+     * Available cipher methods that are considered safe to use.
+     * @var array
+     */
+    protected allowedCiphers;
+
+    /**
+     * The allowed cipher methods as keys, for fast lookups.
+     * @var array
+     */
+    protected allowedCiphersLookup;
+
     /**
      * The cipher iv length.
      * @var int
@@ -117,108 +130,23 @@ class Crypt implements CryptInterface
      */
     public function decrypt(string! text, string! key = null) -> string
     {
-        var authData, authTag, decryptKey, ivLength, cipher, mode, blockSize,
-            decrypted, ciphertext, hashAlgo, hashLength, iv, hash;
+        var decryptKey, hashAlgo, mode;
 
-        if likely empty key {
-            let decryptKey = this->key;
-        } else {
-            let decryptKey = key;
-        }
+        let decryptKey = this->getCryptKey(key, "Decryption key cannot be empty"),
+            mode       = this->getMode();
 
-        if unlikely empty decryptKey {
-            throw new Exception("Decryption key cannot be empty");
-        }
-
-        let cipher   = this->cipher,
-            mode     = strtolower(substr(cipher, strrpos(cipher, "-") - strlen(cipher))),
-            authData = this->authData,
-            authTag  = this->authTag;
-
-        this->assertCipherIsAvailable(cipher);
-
-        let ivLength = this->ivLength;
-
-        if likely ivLength > 0 {
-            let blockSize = ivLength;
-        } else {
-            let blockSize = this->getIvLength(str_ireplace("-" . mode, "", cipher));
-        }
+        this->assertCipherIsAvailable(this->cipher);
 
-        let iv = mb_substr(text, 0, ivLength, "8bit");
+        let hashAlgo = this->getHashAlgo();
 
-        if this->useSigning {
-            let hashAlgo   = this->getHashAlgo(),
-                hashLength = strlen(hash(hashAlgo, "", true)),
-                hash       = mb_substr(text, ivLength, hashLength, "8bit"),
-                ciphertext = mb_substr(text, ivLength + hashLength, null, "8bit");
-
-            if ("-gcm" === mode || "-ccm" === mode) && !empty this->authData {
-                let decrypted = openssl_decrypt(
-                    ciphertext,
-                    cipher,
-                    decryptKey,
-                    OPENSSL_RAW_DATA,
-                    iv,
-                    authTag,
-                    authData
-                );
-            } else {
-                let decrypted = openssl_decrypt(
-                    ciphertext,
-                    cipher,
-                    decryptKey,
-                    OPENSSL_RAW_DATA,
-                    iv
-                );
-            }
-
-            if mode == "-cbc" || mode == "-ecb" {
-                let decrypted = this->cryptUnpadText(decrypted, mode, blockSize, this->padding);
-            }
-
-            /**
-             * Checks on the decrypted's message digest using the HMAC method.
-             */
-            if unlikely hash_hmac(hashAlgo, decrypted, decryptKey, true) !== hash {
-                throw new Mismatch("Hash does not match.");
-            }
-
-            return decrypted;
-        }
-
-        let ciphertext = mb_substr(text, ivLength, null, "8bit");
-
-        if ("-gcm" === mode || "-ccm" === mode) && !empty this->authData {
-            let decrypted = openssl_decrypt(
-                ciphertext,
-                cipher,
-                decryptKey,
-                OPENSSL_RAW_DATA,
-                iv,
-                authTag,
-                authData
-            );
-        } else {
-            let decrypted = openssl_decrypt(
-                ciphertext,
-                cipher,
-                decryptKey,
-                OPENSSL_RAW_DATA,
-                iv
-            );
-        }
-
-        if mode == "-cbc" || mode == "-ecb" {
-            let decrypted = this->cryptUnpadText(
-                decrypted,
-                mode,
-                blockSize,
-                this->padding
-            );
-        }
-
-        return decrypted;
+        return this->decryptText(
+            text,
+            decryptKey,
+            mode,
+            this->getBlockSize(mode),
+            hashAlgo,
+            this->getHashLength(hashAlgo)
+        );
     }
 
     /**
@@ -239,105 +167,95 @@ class Crypt implements CryptInterface
     }
 
     /**
-     * Encrypts a text.
+     * Decrypts many encrypted texts with the same key. The cipher checks,
+     * block size and hash length are resolved once for the whole batch.
+     * The keys of the array are preserved. In gcm and ccm modes with auth
+     * data, every text ends with its own authentication tag, as returned by
+     * encryptMany().
      *
      * ```php
-     * $encrypted = $crypt->encrypt(
-     *     "Top secret",
-     *     "T4\xb1\x8d\xa9\x98\x05\\\x8c\xbe\x1d\x07&[\x99\x18\xa4~Lc1\xbeW\xb3"
+     * $decrypted = $crypt->decryptMany(
+     *     [
+     *         "name"  => $encryptedName,
+     *         "email" => $encryptedEmail,
+     *     ]
      * );
      * ```
+     *
+     * @throws \Phalcon\Crypt\Mismatch
      */
-    public function encrypt(string! text, string! key = null) -> string
+    public function decryptMany(array! texts, string! key = null) -> array
     {
-        var authData, authTag, authTagLength, encryptKey, ivLength, iv,
-            cipher, mode, blockSize, paddingType, padded, encrypted;
-
-        if likely empty key {
-            let encryptKey = this->key;
-        } else {
-            let encryptKey = key;
-        }
-
-        if unlikely empty encryptKey {
-            throw new Exception("Encryption key cannot be empty");
-        }
-
-        let cipher = this->cipher;
-
-        let mode = strtolower(
-            substr(
-                cipher,
-                strrpos(cipher, "-") - strlen(cipher)
-            )
-        );
-
-        this->assertCipherIsAvailable(cipher);
-
-        let ivLength = this->ivLength;
-
-        if likely ivLength > 0 {
-            let blockSize = ivLength;
-        } else {
-            let blockSize = this->getIvLength(
-                str_ireplace(
-                    "-" . mode,
-                    "",
-                    cipher
-                )
-            );
-        }
+        var authTag, blockSize, decryptKey, e, hashAlgo, hashLength, index,
+            mode, text;
+        int tagLength;
+        array results;
+
+        let decryptKey = this->getCryptKey(key, "Decryption key cannot be empty"),
+            mode       = this->getMode();
+
+        this->assertCipherIsAvailable(this->cipher);
+
+        let blockSize  = this->getBlockSize(mode),
+            hashAlgo   = this->getHashAlgo(),
+            hashLength = this->getHashLength(hashAlgo),
+            tagLength  = this->getBatchTagLength(mode),
+            authTag    = this->authTag,
+            results    = [];
+
+        try {
+            for index, text in texts {
+                if tagLength > 0 {
+                    let this->authTag = mb_substr(text, -tagLength, null, "8bit"),
+                        text          = mb_substr(text, 0, -tagLength, "8bit");
+                }
 
-        let iv          = openssl_random_pseudo_bytes(ivLength),
-            paddingType = this->padding;
+                let results[index] = this->decryptText(
+                    text,
+                    decryptKey,
+                    mode,
+                    blockSize,
+                    hashAlgo,
+                    hashLength
+                );
+            }
+        } catch Throwable, e {
+            let this->authTag = authTag;
 
-        if paddingType != 0 && (mode == "-cbc" || mode == "-ecb") {
-            let padded = this->cryptPadText(text, mode, blockSize, paddingType);
-        } else {
-            let padded = text;
+            throw e;
         }
 
-        /**
-         * If the mode is "gcm" or "ccm" and auth data has been passed call it
-         * with that data
-         */
-        if ("-gcm" === mode || "-ccm" === mode) && !empty this->authData {
-            let authData      = this->authData,
-                authTag       = this->authTag,
-                authTagLength = this->authTagLength;
+        let this->authTag = authTag;
 
-            let encrypted = openssl_encrypt(
-                padded,
-                cipher,
-                encryptKey,
-                OPENSSL_RAW_DATA,
-                iv,
-                authTag,
-                authData,
-                authTagLength
-            );
-
-            let this->authTag = authTag;
-        } else {
-            let encrypted = openssl_encrypt(
-                padded,
-                cipher,
-                encryptKey,
-                OPENSSL_RAW_DATA,
-                iv
-            );
-        }
+        return results;
+    }
 
-        if this->useSigning {
-            var digest, hashAlgo;
+    /**
+     * Encrypts a text.
+     *
+     * ```php
+     * $encrypted = $crypt->encrypt(
+     *     "Top secret",
+     *     "T4\xb1\x8d\xa9\x98\x05\\\x8c\xbe\x1d\x07&[\x99\x18\xa4~Lc1\xbeW\xb3"
+     * );
+     * ```
+     */
+    public function encrypt(string! text, string! key = null) -> string
+    {
+        var encryptKey, mode;
 
-            let hashAlgo = this->getHashAlgo();
-            let digest = hash_hmac(hashAlgo, padded, encryptKey, true);
+        let encryptKey = this->getCryptKey(key, "Encryption key cannot be empty"),
+            mode       = this->getMode();
 
-            return iv . digest . encrypted;
-        }
+        this->assertCipherIsAvailable(this->cipher);
 
-        return iv . encrypted;
+        return this->encryptText(
+            text,
+            encryptKey,
+            mode,
+            this->getBlockSize(mode),
+            this->getHashAlgo()
+        );
     }
 
     /**
@@ -364,33 +282,65 @@ class Crypt implements CryptInterface
     }
 
     /**
-     * Returns a list of available ciphers.
+     * Encrypts many texts with the same key. The cipher checks and block
+     * size are resolved once for the whole batch. The keys of the array are
+     * preserved. In gcm and ccm modes with auth data, the authentication
+     * tag of every text is appended to it, so that decryptMany() can check
+     * each one.
+     *
+     * ```php
+     * $encrypted = $crypt->encryptMany(
+     *     [
+     *         "name"  => "Phalcon",
+     *         "email" => "team@phalcon.io",
+     *     ]
+     * );
+     * ```
      */
-    public function getAvailableCiphers() -> array
+    public function encryptMany(array! texts, string! key = null) -> array
     {
-        var availableCiphers, cipher;
-        array allowedCiphers;
+        var blockSize, encryptKey, hashAlgo, index, mode, text;
+        int tagLength;
+        array results;
 
-        let availableCiphers = this->availableCiphers;
+        let encryptKey = this->getCryptKey(key, "Encryption key cannot be empty"),
+            mode       = this->getMode();
 
-        if unlikely typeof availableCiphers !== "array" {
-            this->initializeAvailableCiphers();
+        this->assertCipherIsAvailable(this->cipher);
 
-            let availableCiphers = this->availableCiphers;
-        }
+        let blockSize = this->getBlockSize(mode),
+            hashAlgo  = this->getHashAlgo(),
+            results   = [];
+
+        let tagLength = this->getBatchTagLength(mode);
 
-        let allowedCiphers = [];
-        for cipher in availableCiphers {
-            if !(starts_with(strtolower(cipher), "des") ||
-                 starts_with(strtolower(cipher), "rc2") ||
-                 starts_with(strtolower(cipher), "rc4") ||
-                 starts_with(strtolower(cipher), "des") ||
-                 ends_with(strtolower(cipher), "ecb")) {
-                let allowedCiphers[] = cipher;
+        for index, text in texts {
+            let results[index] = this->encryptText(
+                text,
+                encryptKey,
+                mode,
+                blockSize,
+                hashAlgo
+            );
+
+            if tagLength > 0 {
+                let results[index] = results[index] . this->authTag;
             }
         }
 
-        return allowedCiphers;
+        return results;
+    }
+
+    /**
+     * Returns a list of available ciphers.
+     */
+    public function getAvailableCiphers() -> array
+    {
+        if unlikely typeof this->allowedCiphers !== "array" {
+            this->initializeAvailableCiphers();
+        }
+
+        return this->allowedCiphers;
     }
 
     /**
@@ -530,11 +480,11 @@ class Crypt implements CryptInterface
      */
     protected function assertCipherIsAvailable(string! cipher) -> void
     {
-        var availableCiphers;
-
-        let availableCiphers = this->getAvailableCiphers();
+        if unlikely typeof this->allowedCiphersLookup !== "array" {
+            this->initializeAvailableCiphers();
+        }
 
-        if unlikely !in_array(strtoupper(cipher), availableCiphers) {
+        if unlikely !isset this->allowedCiphersLookup[strtoupper(cipher)] {
             throw new Exception(
                 sprintf(
                     "The cipher algorithm \"%s\" is not supported on this system.",
@@ -564,7 +514,193 @@ class Crypt implements CryptInterface
     }
 
     /**
-     * Initialize available cipher algorithms.
+     * Decrypts a single text with already resolved settings
+     */
+    protected function decryptText(
+        string! text,
+        string! decryptKey,
+        string! mode,
+        int blockSize,
+        string! hashAlgo,
+        int hashLength
+    ) -> string {
+        var authData, authTag, cipher, ciphertext, decrypted, hash, iv,
+            ivLength;
+
+        let cipher   = this->cipher,
+            authData = this->authData,
+            authTag  = this->authTag,
+            ivLength = this->ivLength,
+            iv       = mb_substr(text, 0, ivLength, "8bit");
+
+        if this->useSigning {
+            let hash       = mb_substr(text, ivLength, hashLength, "8bit"),
+                ciphertext = mb_substr(text, ivLength + hashLength, null, "8bit");
+        } else {
+            let ciphertext = mb_substr(text, ivLength, null, "8bit");
+        }
+
+        if ("-gcm" === mode || "-ccm" === mode) && !empty authData {
+            let decrypted = openssl_decrypt(
+                ciphertext,
+                cipher,
+                decryptKey,
+                OPENSSL_RAW_DATA,
+                iv,
+                authTag,
+                authData
+            );
+        } else {
+            let decrypted = openssl_decrypt(
+                ciphertext,
+                cipher,
+                decryptKey,
+                OPENSSL_RAW_DATA,
+                iv
+            );
+        }
+
+        if mode == "-cbc" || mode == "-ecb" {
+            let decrypted = this->cryptUnpadText(
+                decrypted,
+                mode,
+                blockSize,
+                this->padding
+            );
+        }
+
+        /**
+         * Checks on the decrypted's message digest using the HMAC method.
+         */
+        if this->useSigning && hash_hmac(hashAlgo, decrypted, decryptKey, true) !== hash {
+            throw new Mismatch("Hash does not match.");
+        }
+
+        return decrypted;
+    }
+
+    /**
+     * Encrypts a single text with already resolved settings
+     */
+    protected function encryptText(
+        string! text,
+        string! encryptKey,
+        string! mode,
+        int blockSize,
+        string! hashAlgo
+    ) -> string {
+        var authData, authTag, authTagLength, cipher, encrypted, iv, padded,
+            paddingType;
+
+        let cipher      = this->cipher,
+            iv          = openssl_random_pseudo_bytes(this->ivLength),
+            paddingType = this->padding;
+
+        if paddingType != 0 && (mode == "-cbc" || mode == "-ecb") {
+            let padded = this->cryptPadText(text, mode, blockSize, paddingType);
+        } else {
+            let padded = text;
+        }
+
+        /**
+         * If the mode is "gcm" or "ccm" and auth data has been passed call it
+         * with that data
+         */
+        if ("-gcm" === mode || "-ccm" === mode) && !empty this->authData {
+            let authData      = this->authData,
+                authTag       = this->authTag,
+                authTagLength = this->authTagLength;
+
+            let encrypted = openssl_encrypt(
+                padded,
+                cipher,
+                encryptKey,
+                OPENSSL_RAW_DATA,
+                iv,
+                authTag,
+                authData,
+                authTagLength
+            );
+
+            let this->authTag = authTag;
+        } else {
+            let encrypted = openssl_encrypt(
+                padded,
+                cipher,
+                encryptKey,
+                OPENSSL_RAW_DATA,
+                iv
+            );
+        }
+
+        if this->useSigning {
+            return iv . hash_hmac(hashAlgo, padded, encryptKey, true) . encrypted;
+        }
+
+        return iv . encrypted;
+    }
+
+    /**
+     * Returns the length of the authentication tag appended to every text
+     * of a batch, 0 when the mode doesn't authenticate
+     */
+    protected function getBatchTagLength(string! mode) -> int
+    {
+        if ("-gcm" === mode || "-ccm" === mode) && !empty this->authData {
+            return this->authTagLength;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the block size of the current cipher
+     */
+    protected function getBlockSize(string! mode) -> int
+    {
+        if likely this->ivLength > 0 {
+            return this->ivLength;
+        }
+
+        return this->getIvLength(
+            str_ireplace("-" . mode, "", this->cipher)
+        );
+    }
+
+    /**
+     * Returns the key to use, throwing an exception if there is none
+     */
+    protected function getCryptKey(var key, string! message) -> string
+    {
+        var cryptKey;
+
+        if likely empty key {
+            let cryptKey = this->key;
+        } else {
+            let cryptKey = key;
+        }
+
+        if unlikely empty cryptKey {
+            throw new Exception(message);
+        }
+
+        return cryptKey;
+    }
+
+    /**
+     * Returns the length of the message digest, 0 when signing is disabled
+     */
+    protected function getHashLength(string! hashAlgo) -> int
+    {
+        if !this->useSigning {
+            return 0;
+        }
+
+        return strlen(hash(hashAlgo, "", true));
+    }
+
+    /**
+     * Returns the length of the initialization vector of a cipher
      */
     protected function getIvLength(string! cipher) -> int
     {
@@ -576,23 +712,56 @@ class Crypt implements CryptInterface
     }
 
     /**
-     * Initialize available cipher algorithms.
+     * Returns the mode of the current cipher, e.g. "-cbc"
+     */
+    protected function getMode() -> string
+    {
+        var cipher;
+
+        let cipher = this->cipher;
+
+        return strtolower(
+            substr(
+                cipher,
+                strrpos(cipher, "-") - strlen(cipher)
+            )
+        );
+    }
+
+    /**
+     * Initialize available cipher algorithms. The ones considered unsafe
+     * (DES, RC2, RC4 and the ECB modes) are filtered out once here.
      */
     protected function initializeAvailableCiphers() -> void
     {
-        var availableCiphers, i, cipher;
+        var availableCiphers, i, cipher, lowerCipher;
+        array allowedCiphers, allowedCiphersLookup;
 
         if unlikely !function_exists("openssl_get_cipher_methods") {
             throw new Exception("openssl extension is required");
         }
 
-        let availableCiphers = openssl_get_cipher_methods(true);
+        let availableCiphers     = openssl_get_cipher_methods(true),
+            allowedCiphers       = [],
+            allowedCiphersLookup = [];
 
         for i, cipher in availableCiphers {
-            let availableCiphers[i] = strtoupper(cipher);
+            let cipher              = strtoupper(cipher),
+                lowerCipher         = strtolower(cipher),
+                availableCiphers[i] = cipher;
+
+            if !(starts_with(lowerCipher, "des") ||
+                 starts_with(lowerCipher, "rc2") ||
+                 starts_with(lowerCipher, "rc4") ||
+                 ends_with(lowerCipher, "ecb")) {
+                let allowedCiphers[]             = cipher,
+                    allowedCiphersLookup[cipher] = true;
+            }
         }
 
-        let this->availableCiphers = availableCiphers;
+        let this->availableCiphers     = availableCiphers,
+            this->allowedCiphers       = allowedCiphers,
+            this->allowedCiphersLookup = allowedCiphersLookup;
     }
 
     /**
@@ -10,6 +10,7 @@
 
 namespace Phalcon\Db\Adapter;
 
+use Phalcon\Db\Dialect;
 use Phalcon\Db\DialectInterface;
 use Phalcon\Db\ColumnInterface;
 use Phalcon\Db\Enum;
@@ -70,6 +71,14 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
      */
     protected sqlBindTypes;
 
+    /**
+     * Whether the last upsert inserted its row, null when the adapter cannot
+     * tell
+     *
+     * @var bool | null
+     */
+    protected upsertInserted = null;
+
     /**
      * Active SQL Statement
      *
@@ -888,6 +897,16 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->transactionsWithSavepoints;
     }
 
+    /**
+     * Returns whether the last upsert inserted its row (true) or found an
+     * existing one (false). It's null when the database system doesn't
+     * report it
+     */
+    public function lastUpsertInserted() -> bool | null
+    {
+        return this->upsertInserted;
+    }
+
     /**
      * Appends a LIMIT clause to $sqlQuery argument
      *
@@ -1068,6 +1087,18 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return false;
     }
 
+    /**
+     * Checks whether the dialect can insert or update a row in one statement
+     */
+    public function supportsUpsert() -> bool
+    {
+        var dialect;
+
+        let dialect = this->dialect;
+
+        return dialect instanceof Dialect && dialect->supportsUpsert();
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.table
      *
@@ -1290,6 +1321,103 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->update(table, fields, values, whereCondition, dataTypes);
     }
 
+    /**
+     * Inserts a row or, when a row with the same conflictFields already
+     * exists, updates its updateFields with the new values
+     *
+     * ```php
+     * // Inserting or updating a robot
+     * $success = $connection->upsert(
+     *     "robots",
+     *     [101, "Astro Boy", 1952],
+     *     ["id", "name", "year"],
+     *     ["id"],
+     *     ["name", "year"]
+     * );
+     *
+     * // Next SQL sentence is sent to a MySQL database system
+     * INSERT INTO `robots` (`id`, `name`, `year`) VALUES (101, "Astro Boy", 1952)
+     *     ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`)
+     * ```
+     */
+    public function upsert(string table, array! values, array! fields, array! conflictFields, array! updateFields, var dataTypes = null) -> bool
+    {
+        var bindDataTypes, bindType, placeholders, position, schemaName,
+            tableName, upsertSql, upsertValues, value;
+
+        if unlikely !count(values) {
+            throw new Exception(
+                "Unable to upsert into " . table . " without data"
+            );
+        }
+
+        if unlikely !this->supportsUpsert() {
+            throw new Exception(
+                "The dialect doesn't support upserts"
+            );
+        }
+
+        let placeholders  = [],
+            upsertValues  = [],
+            bindDataTypes = [];
+
+        /**
+         * The values are passed like in insert()
+         */
+        for position, value in values {
+            if typeof value == "object" && value instanceof RawValue {
+                let placeholders[] = (string) value;
+            } else {
+                if typeof value == "object" {
+                    let value = (string) value;
+                }
+
+                if value === null {
+                    let placeholders[] = "null";
+                } else {
+                    let placeholders[] = "?";
+                    let upsertValues[] = value;
+
+                    if typeof dataTypes == "array" {
+                        if unlikely !fetch bindType, dataTypes[position] {
+                            throw new Exception(
+                                "Incomplete number of bind types"
+                            );
+                        }
+
+                        let bindDataTypes[] = bindType;
+                    }
+                }
+            }
+        }
+
+        if strpos(table, ".") > 0 {
+            let tableName  = explode(".", table),
+                schemaName = tableName[0],
+                tableName  = tableName[1];
+        } else {
+            let tableName  = table,
+                schemaName = null;
+        }
+
+        let upsertSql = this->dialect->{"upsert"}(
+            tableName,
+            fields,
+            placeholders,
+            conflictFields,
+            updateFields,
+            schemaName
+        );
+
+        let this->upsertInserted = null;
+
+        if !count(bindDataTypes) {
+            let bindDataTypes = null;
+        }
+
+        return this->executeUpsert(upsertSql, upsertValues, bindDataTypes);
+    }
+
     /**
      * Check whether the database system requires an explicit value for identity
      * columns
@@ -1312,4 +1440,13 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
     {
         return this->fetchOne(this->dialect->viewExists(viewName, schemaName), Enum::FETCH_NUM)[0] > 0;
     }
+
+    /**
+     * Sends the statement generated by upsert(). Adapters that can tell an
+     * insert from an update set upsertInserted here
+     */
+    protected function executeUpsert(string! sqlStatement, array! bindParams, var bindTypes = null) -> bool
+    {
+        return this->{"execute"}(sqlStatement, bindParams, bindTypes);
+    }
 }
@@ -569,6 +569,39 @@ class Mysql extends PdoAdapter
         return referenceObjects;
     }
 
+    /**
+     * Check whether the connection can tell an upsert that inserted from one
+     * that updated. With PDO::MYSQL_ATTR_FOUND_ROWS an unchanged row reports
+     * 1 affected row, like an insert, so upserts are not supported
+     */
+    public function supportsUpsert() -> bool
+    {
+        var options, foundRows;
+
+        if fetch options, this->descriptor["options"] {
+            if typeof options == "array" && fetch foundRows, options[\PDO::MYSQL_ATTR_FOUND_ROWS] && foundRows {
+                return false;
+            }
+        }
+
+        return parent::supportsUpsert();
+    }
+
+    /**
+     * MySQL reports 1 affected row when the upsert inserts, 2 when it
+     * updates and 0 when the existing row is left unchanged
+     */
+    protected function executeUpsert(string! sqlStatement, array! bindParams, var bindTypes = null) -> bool
+    {
+        if !this->execute(sqlStatement, bindParams, bindTypes) {
+            return false;
+        }
+
+        let this->upsertInserted = this->affectedRows() == 1;
+
+        return true;
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
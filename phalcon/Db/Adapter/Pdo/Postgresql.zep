@@ -676,6 +676,34 @@ class Postgresql extends PdoAdapter
         return true;
     }
 
+    /**
+     * PostgreSQL reports 1 affected row for both outcomes of an upsert. The
+     * system column xmax of the returned row is 0 only when it was inserted,
+     * and no row is returned when the conflict does nothing
+     */
+    protected function executeUpsert(string! sqlStatement, array! bindParams, var bindTypes = null) -> bool
+    {
+        var result, row;
+
+        let result = this->query(
+            sqlStatement . " RETURNING (xmax = 0) AS inserted",
+            bindParams,
+            bindTypes
+        );
+
+        if typeof result != "object" {
+            return false;
+        }
+
+        result->setFetchMode(Enum::FETCH_ASSOC);
+
+        let row = result->$fetch();
+
+        let this->upsertInserted = typeof row == "array" && (row["inserted"] === true || row["inserted"] === "t");
+
+        return true;
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
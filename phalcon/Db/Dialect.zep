@@ -20,6 +20,22 @@ abstract class Dialect implements DialectInterface
 
     protected customFunctions;
 
+    /**
+     * SQL generated by select(), keyed by the cache id of the definition, the
+     * shape of the bound arrays and the escaping setting. The least recently
+     * used statement is the first one
+     *
+     * @var array
+     */
+    protected selectCache = [];
+
+    /**
+     * Maximum number of statements kept in the select cache
+     *
+     * @var int
+     */
+    protected selectCacheSize = 1024;
+
     /**
      * Generate SQL to create a new savepoint
      */
@@ -431,7 +447,8 @@ abstract class Dialect implements DialectInterface
      */
     public function registerCustomFunction(string name, callable customFunction) -> <Dialect>
     {
-        let this->customFunctions[name] = customFunction;
+        let this->customFunctions[name] = customFunction,
+            this->selectCache           = [];
 
         return this;
     }
@@ -453,9 +470,61 @@ abstract class Dialect implements DialectInterface
     }
 
     /**
-     * Builds a SELECT statement
+     * Builds a SELECT statement.
+     *
+     * Definitions carrying a `cacheId` (Phalcon\Mvc\Model\Query passes the
+     * id of the parsed PHQL) are memoized together with the shape of the
+     * bound arrays in `bindCounts`, so executing the same statement again
+     * does not walk the expressions a second time.
      */
     public function select(array! definition) -> string
+    {
+        var bindCounts, cacheId, cacheKey, oldestKey, sql;
+
+        if !fetch cacheId, definition["cacheId"] {
+            return this->buildSelect(definition);
+        }
+
+        let cacheKey = cacheId;
+
+        if fetch bindCounts, definition["bindCounts"] {
+            let cacheKey .= ":" . serialize(bindCounts);
+        }
+
+        if globals_get("db.escape_identifiers") {
+            let cacheKey .= ":e";
+        }
+
+        if fetch sql, this->selectCache[cacheKey] {
+            /**
+             * Move the statement to the end, as the most recently used
+             */
+            unset this->selectCache[cacheKey];
+
+            let this->selectCache[cacheKey] = sql;
+
+            return sql;
+        }
+
+        let sql = this->buildSelect(definition);
+
+        if count(this->selectCache) >= this->selectCacheSize {
+            for oldestKey, _ in this->selectCache {
+                unset this->selectCache[oldestKey];
+
+                break;
+            }
+        }
+
+        let this->selectCache[cacheKey] = sql;
+
+        return sql;
+    }
+
+    /**
+     * Generates the SQL of a SELECT statement
+     */
+    protected function buildSelect(array! definition) -> string
     {
         var tables, columns, sql, distinct, joins, where, escapeChar, groupBy,
             having, orderBy, limit, forUpdate, bindCounts;
@@ -571,6 +640,26 @@ abstract class Dialect implements DialectInterface
         return this->supportsSavePoints();
     }
 
+    /**
+     * Checks whether the platform can insert or update a row in one statement
+     */
+    public function supportsUpsert() -> bool
+    {
+        return false;
+    }
+
+    /**
+     * Generates SQL inserting a row or, when a row with the same
+     * conflictFields exists, updating its updateFields. The values are SQL
+     * expressions, usually placeholders
+     */
+    public function upsert(string! tableName, array! fields, array! values, array! conflictFields, array! updateFields, string schemaName = null) -> string
+    {
+        throw new Exception(
+            "The dialect doesn't support upserts"
+        );
+    }
+
     /**
      * Returns the size of the column enclosed in parentheses
      */
@@ -1105,6 +1194,50 @@ abstract class Dialect implements DialectInterface
         return table;
     }
 
+    /**
+     * Prepares an INSERT of the values in the fields
+     */
+    protected function prepareInsert(string! tableName, array! fields, array! values, string schemaName = null) -> string
+    {
+        var field, escapedFields;
+
+        let escapedFields = [];
+
+        for field in fields {
+            let escapedFields[] = this->escape(field);
+        }
+
+        return "INSERT INTO " . this->prepareTable(tableName, schemaName) . " (" . join(", ", escapedFields) . ") VALUES (" . join(", ", values) . ")";
+    }
+
+    /**
+     * Prepares an INSERT ... ON CONFLICT statement
+     */
+    protected function prepareUpsertOnConflict(string! tableName, array! fields, array! values, array! conflictFields, array! updateFields, string schemaName = null) -> string
+    {
+        var field, escapedConflictFields, updates;
+        string sql;
+
+        let escapedConflictFields = [],
+            updates               = [];
+
+        for field in conflictFields {
+            let escapedConflictFields[] = this->escape(field);
+        }
+
+        let sql = this->prepareInsert(tableName, fields, values, schemaName) . " ON CONFLICT (" . join(", ", escapedConflictFields) . ")";
+
+        if !count(updateFields) {
+            return sql . " DO NOTHING";
+        }
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = EXCLUDED." . this->escape(field);
+        }
+
+        return sql . " DO UPDATE SET " . join(", ", updates);
+    }
+
     /**
      * Prepares qualified for this RDBMS
      */
@@ -789,6 +789,43 @@ class Mysql extends Dialect
         return "TRUNCATE TABLE " . table;
     }
 
+    /**
+     * Checks whether the platform can insert or update a row in one statement
+     */
+    public function supportsUpsert() -> bool
+    {
+        return true;
+    }
+
+    /**
+     * Generates an INSERT ... ON DUPLICATE KEY UPDATE statement. MySQL uses
+     * any unique key of the table, so conflictFields only matter when there
+     * is nothing to update
+     */
+    public function upsert(string! tableName, array! fields, array! values, array! conflictFields, array! updateFields, string schemaName = null) -> string
+    {
+        var field, updates;
+
+        let updates = [];
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = VALUES(" . this->escape(field) . ")";
+        }
+
+        /**
+         * Leave the existing row as it is
+         */
+        if !count(updates) {
+            if !fetch field, conflictFields[0] {
+                let field = fields[0];
+            }
+
+            let updates[] = this->escape(field) . " = " . this->escape(field);
+        }
+
+        return this->prepareInsert(tableName, fields, values, schemaName) . " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
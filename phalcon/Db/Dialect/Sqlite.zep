@@ -640,6 +640,29 @@ class Sqlite extends Dialect
         return "DELETE FROM " . table;
     }
 
+    /**
+     * Checks whether the platform can insert or update a row in one statement
+     */
+    public function supportsUpsert() -> bool
+    {
+        return true;
+    }
+
+    /**
+     * Generates an INSERT ... ON CONFLICT DO UPDATE statement
+     */
+    public function upsert(string! tableName, array! fields, array! values, array! conflictFields, array! updateFields, string schemaName = null) -> string
+    {
+        return this->prepareUpsertOnConflict(
+            tableName,
+            fields,
+            values,
+            conflictFields,
+            updateFields,
+            schemaName
+        );
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
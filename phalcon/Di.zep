@@ -19,6 +19,7 @@ use Phalcon\Config\Adapter\Yaml;
 use Phalcon\Di\ServiceInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Di\ServiceProviderInterface;
 
 /**
@@ -530,6 +531,36 @@ class Di implements DiInterface
         let self::_default = null;
     }
 
+    /**
+     * Resets the per request state of the shared instances already resolved
+     * that implement Phalcon\Di\ResettableInterface. Long running workers
+     * call it between requests to reuse the bootstrapped container.
+     *
+     * ```php
+     * while ($uri = $worker->next()) {
+     *     $response = $application->handle($uri);
+     *
+     *     $container->resetServices();
+     * }
+     * ```
+     */
+    public function resetServices() -> void
+    {
+        var instance, sharedInstances;
+
+        let sharedInstances = this->sharedInstances;
+
+        if typeof sharedInstances != "array" {
+            return;
+        }
+
+        for instance in sharedInstances {
+            if instance instanceof ResettableInterface {
+                instance->reset();
+            }
+        }
+    }
+
     /**
      * Registers a service in the services container
      */
@@ -0,0 +1,25 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Di;
+
+/**
+ * This interface must be implemented by shared services that keep per request
+ * state, so that a long running worker can handle many requests with the same
+ * container. Phalcon\Di::resetServices() calls reset() on every resolved
+ * shared instance implementing it.
+ */
+interface ResettableInterface
+{
+    /**
+     * Clears the state collected while handling the current request
+     */
+    public function reset();
+}
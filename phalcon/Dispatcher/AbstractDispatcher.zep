@@ -13,19 +13,21 @@ namespace Phalcon\Dispatcher;
 use Exception;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Dispatcher\Exception as PhalconException;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Filter\FilterInterface;
 use Phalcon\Mvc\Model\Binder;
 use Phalcon\Mvc\Model\BinderInterface;
+use Phalcon\Storage\Adapter\AdapterInterface;
 
 /**
  * This is the base class for Phalcon\Mvc\Dispatcher and Phalcon\Cli\Dispatcher.
  * This class can't be instantiated directly, you can use it to create your own
  * dispatchers.
  */
-abstract class AbstractDispatcher extends AbstractInjectionAware implements DispatcherInterface, EventsAwareInterface
+abstract class AbstractDispatcher extends AbstractInjectionAware implements DispatcherInterface, EventsAwareInterface, ResettableInterface
 {
     protected activeHandler;
 
@@ -55,11 +57,50 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
 
     protected defaultHandler = null;
 
+    /**
+     * Handler class, action method and binding cache key resolved for each
+     * namespace, handler and action
+     *
+     * @var array
+     */
+    protected dispatchPlans = [];
+
+    /**
+     * @var AdapterInterface | null
+     */
+    protected dispatchPlansCache = null;
+
+    /**
+     * Whether plans were added since the cache was read
+     *
+     * @var bool
+     */
+    protected dispatchPlansChanged = false;
+
+    /**
+     * @var string | null
+     */
+    protected dispatchPlansKey = null;
+
+    /**
+     * Maximum number of dispatch plans kept
+     *
+     * @var int
+     */
+    protected dispatchPlansLimit = 1024;
+
     /**
      * @var array
      */
     protected handlerHashes = [];
 
+    /**
+     * Callable action and lifecycle methods of each handler class and action
+     *
+     * @var array
+     */
+    protected handlerMethods = [];
+
     protected handlerName = null;
 
     /**
@@ -100,6 +141,14 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
     protected previousActionName = null;
     protected previousHandlerName = null;
     protected previousNamespaceName = null;
+
+    /**
+     * Handler classes known to be loadable
+     *
+     * @var array
+     */
+    protected resolvedHandlers = [];
+
     protected returnedValue = null;
 
     public function callActionMethod(handler, string actionMethod, array! params = [])
@@ -126,7 +175,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         int numberDispatches;
         var value, handler, container, namespaceName, handlerName, actionName,
             params, eventsManager, handlerClass, status, actionMethod,
-            modelBinder, bindCacheKey, isNewHandler, handlerHash, e;
+            modelBinder, isNewHandler, handlerHash, e, plan, methods;
 
         let container = <DiInterface> this->container;
 
@@ -223,20 +272,29 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            let handlerClass = this->getHandlerClass();
+            let plan         = this->getDispatchPlan(),
+                handlerClass = plan["handlerClass"];
 
             /**
              * Handlers are retrieved as shared instances from the Service
              * Container
              */
-            let hasService = (bool) container->has(handlerClass);
+            if isset this->resolvedHandlers[handlerClass] {
+                let hasService = true;
+            } else {
+                let hasService = (bool) container->has(handlerClass);
 
-            if !hasService {
-                /**
-                 * DI doesn't have a service with that name, try to load it
-                 * using an autoloader
-                 */
-                let hasService = (bool) class_exists(handlerClass);
+                if !hasService {
+                    /**
+                     * DI doesn't have a service with that name, try to load it
+                     * using an autoloader
+                     */
+                    let hasService = (bool) class_exists(handlerClass);
+
+                    if hasService {
+                        let this->resolvedHandlers[handlerClass] = true;
+                    }
+                }
             }
 
             // If the service can be loaded we throw an exception
@@ -305,9 +363,10 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             }
 
             // Check if the method exists in the handler
-            let actionMethod = this->getActiveMethod();
+            let actionMethod = plan["actionMethod"],
+                methods      = this->getHandlerMethods(handler, actionMethod);
 
-            if unlikely !is_callable([handler, actionMethod]) {
+            if unlikely !methods["action"] {
                 if hasEventsManager {
                     if eventsManager->fire("dispatch:beforeNotFoundAction", this) === false {
                         continue;
@@ -334,6 +393,11 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 break;
             }
 
+            /**
+             * Only plans of handlers and actions that exist are kept
+             */
+            this->addDispatchPlan(plan, handler, methods);
+
             /**
              * In order to ensure that the `initialize()` gets called we'll
              * destroy the current handlerClass from the DI container in the
@@ -364,7 +428,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            if method_exists(handler, "beforeExecuteRoute") {
+            if methods["beforeExecuteRoute"] {
                 try {
                     // Calling "beforeExecuteRoute" as direct method
                     if handler->beforeExecuteRoute(this) === false || this->finished === false {
@@ -401,7 +465,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
              * @see https://github.com/phalcon/cphalcon/pull/13112
              */
             if isNewHandler {
-                if method_exists(handler, "initialize") {
+                if methods["initialize"] {
                     try {
                         let this->isControllerInitialize = true;
 
@@ -447,12 +511,11 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
 
             if this->modelBinding {
                 let modelBinder = this->modelBinder;
-                let bindCacheKey = "_PHMB_" . handlerClass . "_" . actionMethod;
 
                 let params = modelBinder->bindToHandler(
                     handler,
                     params,
-                    bindCacheKey,
+                    plan["bindCacheKey"],
                     actionMethod
                 );
             }
@@ -476,7 +539,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling afterBinding as callback and event
              */
-            if method_exists(handler, "afterBinding") {
+            if methods["afterBinding"] {
                 if handler->afterBinding(this) === false {
                     continue;
                 }
@@ -535,7 +598,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling "afterExecuteRoute" as direct method
              */
-            if method_exists(handler, "afterExecuteRoute") {
+            if methods["afterExecuteRoute"] {
                 try {
                     if handler->afterExecuteRoute(this, value) === false || this->finished === false {
                         continue;
@@ -567,6 +630,13 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             }
         }
 
+        /**
+         * The plans added by this request are written once
+         */
+        if this->dispatchPlansChanged {
+            this->storeDispatchPlans();
+        }
+
         if hasEventsManager {
             try {
                 // Calling "dispatch:afterDispatchLoop" event
@@ -824,6 +894,28 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->finished;
     }
 
+    /**
+     * Clears the handler, action, parameters and returned value of the last
+     * dispatch loop. The defaults, suffixes and model binder are kept
+     */
+    public function reset() -> void
+    {
+        let this->activeHandler          = null,
+            this->actionName             = null,
+            this->finished               = false,
+            this->forwarded              = false,
+            this->handlerName            = null,
+            this->isControllerInitialize = false,
+            this->lastHandler            = null,
+            this->moduleName             = null,
+            this->namespaceName          = null,
+            this->params                 = [],
+            this->previousActionName     = null,
+            this->previousHandlerName    = null,
+            this->previousNamespaceName  = null,
+            this->returnedValue          = null;
+    }
+
     /**
      * Sets the action name to be dispatched
      */
@@ -849,6 +941,35 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         let this->defaultNamespace = namespaceName;
     }
 
+    /**
+     * Stores the dispatch plans (handler classes, action methods and the
+     * lifecycle methods of the handlers) in a cache shared by the requests.
+     * Change the version when the handlers change
+     *
+     * ```php
+     * $dispatcher->setDispatchPlansCache(
+     *     $container->getShared("modelsCache"),
+     *     "1.0.3"
+     * );
+     * ```
+     */
+    public function setDispatchPlansCache(<AdapterInterface> dispatchPlansCache, string! version = "") -> <DispatcherInterface>
+    {
+        var cached;
+
+        let this->dispatchPlansCache = dispatchPlansCache,
+            this->dispatchPlansKey   = "dispatch-plans-" . md5(get_class(this) . ":" . version);
+
+        let cached = dispatchPlansCache->get(this->dispatchPlansKey);
+
+        if typeof cached == "array" && isset cached["plans"] && isset cached["methods"] {
+            let this->dispatchPlans  = array_merge(cached["plans"], this->dispatchPlans),
+                this->handlerMethods = array_merge(cached["methods"], this->handlerMethods);
+        }
+
+        return this;
+    }
+
     /**
      * Possible class name that will be located to dispatch the request
      */
@@ -1003,6 +1124,78 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->forwarded;
     }
 
+    /**
+     * Keeps the plan and the handler methods of a dispatch whose handler
+     * and action exist, up to dispatchPlansLimit plans
+     */
+    protected function addDispatchPlan(array! plan, object handler, array! methods) -> void
+    {
+        var key, methodsKey;
+
+        let key        = plan["key"],
+            methodsKey = get_class(handler) . "::" . plan["actionMethod"];
+
+        if isset this->dispatchPlans[key] && isset this->handlerMethods[methodsKey] {
+            return;
+        }
+
+        if count(this->dispatchPlans) >= this->dispatchPlansLimit {
+            return;
+        }
+
+        let this->dispatchPlans[key]         = plan,
+            this->handlerMethods[methodsKey] = methods,
+            this->dispatchPlansChanged       = true;
+    }
+
+    /**
+     * Returns the handler class, the action method and the model binding
+     * cache key of the current namespace, handler and action
+     */
+    protected function getDispatchPlan() -> array
+    {
+        var handlerClass, actionMethod, key, plan;
+
+        let key = this->namespaceName . "|" . this->handlerName . "|" . this->handlerSuffix . "|" . this->actionName . "|" . this->actionSuffix;
+
+        if fetch plan, this->dispatchPlans[key] {
+            return plan;
+        }
+
+        let handlerClass = this->getHandlerClass(),
+            actionMethod = this->getActiveMethod();
+
+        return [
+            "key":          key,
+            "handlerClass": handlerClass,
+            "actionMethod": actionMethod,
+            "bindCacheKey": "_PHMB_" . handlerClass . "_" . actionMethod
+        ];
+    }
+
+    /**
+     * Returns if the action of the handler can be called and which of the
+     * lifecycle methods the handler has
+     */
+    protected function getHandlerMethods(object handler, string actionMethod) -> array
+    {
+        var key, methods;
+
+        let key = get_class(handler) . "::" . actionMethod;
+
+        if fetch methods, this->handlerMethods[key] {
+            return methods;
+        }
+
+        return [
+            "action":             is_callable([handler, actionMethod]),
+            "beforeExecuteRoute": method_exists(handler, "beforeExecuteRoute"),
+            "initialize":         method_exists(handler, "initialize"),
+            "afterBinding":       method_exists(handler, "afterBinding"),
+            "afterExecuteRoute":  method_exists(handler, "afterExecuteRoute")
+        ];
+    }
+
     /**
      * Set empty properties to their defaults (where defaults are available)
      */
@@ -1024,6 +1217,28 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         }
     }
 
+    /**
+     * Writes the dispatch plans to the cache, if any
+     */
+    protected function storeDispatchPlans() -> void
+    {
+        var dispatchPlansCache;
+
+        let dispatchPlansCache = this->dispatchPlansCache;
+
+        let this->dispatchPlansChanged = false;
+
+        if typeof dispatchPlansCache == "object" {
+            dispatchPlansCache->set(
+                this->dispatchPlansKey,
+                [
+                    "plans":   this->dispatchPlans,
+                    "methods": this->handlerMethods
+                ]
+            );
+        }
+    }
+
     protected function toCamelCase(string input) -> string
     {
         var camelCaseInput;
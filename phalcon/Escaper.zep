@@ -47,6 +47,24 @@ class Escaper implements EscaperInterface
 
     protected htmlQuoteType = 3;
 
+    /**
+     * Renders the attributes as ` name="value"` pairs, escaping the values
+     * like escapeHtmlAttr() in a single pass. Attributes with a numeric key
+     * or a null value are skipped. Returns false if a value is not a scalar
+     *
+     *```php
+     * echo "<a" . $escaper->attributes(["href" => "/", "class" => "x"]) . ">";
+     *```
+     */
+    public function attributes(array! attributes) -> string | bool
+    {
+        return phalcon_html_render_attributes(
+            attributes,
+            this->encoding,
+            this->doubleEncode
+        );
+    }
+
     /**
      * Detect the character encoding of a string to be handled by an encoder.
      * Special-handling for chr(172) and chr(128) to chr(159) which fail to be
@@ -94,6 +112,17 @@ class Escaper implements EscaperInterface
      */
     public function escapeCss(string css) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly
+         */
+        let escaped = phalcon_escape_css_fast(css);
+
+        if typeof escaped == "string" {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -109,6 +138,17 @@ class Escaper implements EscaperInterface
      */
     public function escapeJs(string js) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly
+         */
+        let escaped = phalcon_escape_js_fast(js);
+
+        if typeof escaped == "string" {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -119,11 +159,12 @@ class Escaper implements EscaperInterface
     }
 
     /**
-     * Escapes a HTML string. Internally uses htmlspecialchars
+     * Escapes a HTML string. Internally uses htmlspecialchars, the string is
+     * returned as it is when there is nothing to escape
      */
     public function escapeHtml(string text = null) -> string
     {
-        return htmlspecialchars(
+        return phalcon_escape_html_fast(
             text,
             this->htmlQuoteType,
             this->encoding,
@@ -136,7 +177,7 @@ class Escaper implements EscaperInterface
      */
     public function escapeHtmlAttr(string attribute = null) -> string
     {
-        return htmlspecialchars(
+        return phalcon_escape_html_fast(
             attribute,
             ENT_QUOTES,
             this->encoding,
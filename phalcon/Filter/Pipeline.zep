@@ -0,0 +1,147 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Filter;
+
+/**
+ * A precompiled chain of sanitizers, returned by Phalcon\Filter::compile().
+ *
+ * The sanitizer objects are resolved once. Consecutive built in sanitizers
+ * (trim, lower, upper, int, alnum, striptags, special) are fused and applied
+ * natively in a single call, to a string or to a whole array of strings.
+ *
+ * ```php
+ * $pipeline = $filter->compile(["trim", "striptags", "lower"]);
+ *
+ * $names = $pipeline->sanitize($_POST["names"]);
+ * ```
+ */
+class Pipeline
+{
+    /**
+     * Native operations. Keep in sync with ext/phalcon/filter/fused.h
+     */
+    const OP_TRIM      = 1;
+    const OP_LOWER     = 2;
+    const OP_UPPER     = 3;
+    const OP_INT       = 4;
+    const OP_ALNUM     = 5;
+    const OP_STRIPTAGS = 6;
+    const OP_SPECIAL   = 7;
+
+    /**
+     * Each step is an array of native operations (empty if the step cannot
+     * run natively) and the equivalent list of [sanitizer, parameters]
+     *
+     * @var array
+     */
+    protected steps = [];
+
+    /**
+     * Constructor
+     */
+    public function __construct(array! steps = [])
+    {
+        let this->steps = steps;
+    }
+
+    /**
+     * Sanitizes a value
+     */
+    public function __invoke(var value, bool noRecursive = false) -> var
+    {
+        return this->sanitize(value, noRecursive);
+    }
+
+    /**
+     * Returns the compiled steps
+     */
+    public function getSteps() -> array
+    {
+        return this->steps;
+    }
+
+    /**
+     * Sanitizes a value. Arrays are sanitized element by element unless
+     * `noRecursive` is set
+     */
+    public function sanitize(var value, bool noRecursive = false) -> var
+    {
+        var fused, item, ops, sanitizer, step;
+
+        /**
+         * Null value - return immediately
+         */
+        if null === value {
+            return value;
+        }
+
+        for step in this->steps {
+            let ops = step[0];
+
+            if !empty ops && (typeof value === "string" || (typeof value === "array" && !noRecursive)) {
+                let fused = phalcon_filter_fused(value, ops);
+
+                if fused !== false {
+                    let value = fused;
+
+                    continue;
+                }
+            }
+
+            /**
+             * Not fused or not handled natively (non string values, no
+             * mbstring) - apply the sanitizer objects
+             */
+            for item in step[1] {
+                let sanitizer = item[0];
+
+                if typeof value === "array" && !noRecursive {
+                    let value = this->processArrayValues(
+                        value,
+                        sanitizer,
+                        item[1]
+                    );
+                } else {
+                    let value = call_user_func_array(
+                        sanitizer,
+                        array_merge([value], item[1])
+                    );
+                }
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * Processes the array values with a sanitizer
+     */
+    private function processArrayValues(
+        array values,
+        var sanitizer,
+        array sanitizerParams
+    ) -> array
+    {
+        var itemKey, itemValue;
+        array arrayValue;
+
+        let arrayValue = [];
+
+        for itemKey, itemValue in values {
+            let arrayValue[itemKey] = call_user_func_array(
+                sanitizer,
+                array_merge([itemValue], sanitizerParams)
+            );
+        }
+
+        return arrayValue;
+    }
+}
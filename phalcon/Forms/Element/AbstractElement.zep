@@ -86,6 +86,8 @@ abstract class AbstractElement implements ElementInterface
             }
         }
 
+        this->resetValidation();
+
         return this;
     }
 
@@ -96,6 +98,8 @@ abstract class AbstractElement implements ElementInterface
     {
         let this->validators[] = validator;
 
+        this->resetValidation();
+
         return this;
     }
 
@@ -116,6 +120,8 @@ abstract class AbstractElement implements ElementInterface
 
         let this->validators = validators;
 
+        this->resetValidation();
+
         return this;
     }
 
@@ -437,6 +443,8 @@ abstract class AbstractElement implements ElementInterface
 
         let this->filters = filters;
 
+        this->resetValidation();
+
         return this;
     }
 
@@ -477,6 +485,8 @@ abstract class AbstractElement implements ElementInterface
     {
         let this->name = name;
 
+        this->resetValidation();
+
         return this;
     }
 
@@ -499,4 +509,19 @@ abstract class AbstractElement implements ElementInterface
 
         return this;
     }
+
+    /**
+     * Makes the form compile its validation again after the validators,
+     * filters or name of the element changed
+     */
+    protected function resetValidation() -> void
+    {
+        var form;
+
+        let form = this->form;
+
+        if typeof form == "object" {
+            form->resetValidation();
+        }
+    }
 }
@@ -41,13 +41,47 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
 
     protected entity;
 
+    /**
+     * @var bool
+     */
+    protected initialized = false;
+
     protected messages;
 
     protected position;
 
     protected options;
 
-    protected validation { set, get };
+    /**
+     * Whether the elements changed after the form was initialized, so that
+     * this instance compiles its own validation instead of the shared one
+     *
+     * @var bool
+     */
+    protected ownValidation = false;
+
+    /**
+     * Shares the validation compiled from the elements between all the
+     * instances of the form class. Forms building the same validators in
+     * every instance can enable it
+     *
+     * @var bool
+     */
+    protected shareValidation = false;
+
+    protected validation { get };
+
+    /**
+     * @var ValidationInterface | null
+     */
+    protected validationPlan = null;
+
+    /**
+     * Validations compiled for the form classes sharing them
+     *
+     * @var array
+     */
+    protected static validationPlans = [];
 
     /**
      * Phalcon\Forms\Form constructor
@@ -76,6 +110,8 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         if method_exists(this, "initialize") {
             this->{"initialize"}(entity, userOptions);
         }
+
+        let this->initialized = true;
     }
 
     /**
@@ -96,6 +132,8 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
          */
         element->setForm(this);
 
+        this->resetValidation();
+
         if position == null || empty this->elements {
             /**
              * Append the element by its name
@@ -258,6 +296,72 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this;
     }
 
+    /**
+     * Compiles the validators and filters of the elements into a validation
+     * that isValid() reuses until the elements change
+     */
+    public function compileValidation() -> <ValidationInterface>
+    {
+        var className, element, filters, name, validation, validator,
+            validators;
+
+        if typeof this->validationPlan == "object" {
+            return this->validationPlan;
+        }
+
+        let className = get_class(this);
+
+        if this->shareValidation && !this->ownValidation && fetch validation, self::validationPlans[className] {
+            let this->validationPlan = validation;
+
+            return validation;
+        }
+
+        let validation = this->validation;
+
+        if typeof validation != "object" || !(validation instanceof ValidationInterface) {
+            // Create an implicit validation
+            let validation = new Validation();
+        } else {
+            // The validators are added to a copy, so that they are not appended again
+            let validation = clone validation;
+        }
+
+        for element in this->elements {
+            let validators = element->getValidators();
+
+            if count(validators) == 0 {
+                continue;
+            }
+
+            let name = element->getName();
+
+            /**
+            * Append (not overriding) element validators to validation class
+            */
+            for validator in validators {
+                validation->add(name, validator);
+            }
+
+            /**
+             * Assign the filters of the element to the validation
+             */
+            let filters = element->getFilters();
+
+            if typeof filters == "array" {
+                validation->setFilters(name, filters);
+            }
+        }
+
+        let this->validationPlan = validation;
+
+        if this->shareValidation && !this->ownValidation {
+            let self::validationPlans[className] = validation;
+        }
+
+        return validation;
+    }
+
     /**
      * Returns the number of elements in the form
      */
@@ -540,8 +644,7 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
      */
     public function isValid(var data = null, var entity = null) -> bool
     {
-        var messages, element, validators, name, filters, validator, validation,
-            elementMessage;
+        var messages, validation, elementMessage;
         bool validationStatus;
 
         if empty this->elements {
@@ -577,44 +680,11 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
 
         let validationStatus = true;
 
-        let validation = this->getValidation();
-
-        if typeof validation != "object" || !(validation instanceof ValidationInterface) {
-            // Create an implicit validation
-            let validation = new Validation();
-        }
-
-        for element in this->elements {
-            let validators = element->getValidators();
-
-            if count(validators) == 0 {
-                continue;
-            }
-
-            /**
-             * Element's name
-             */
-            let name = element->getName();
-
-            /**
-            * Append (not overriding) element validators to validation class
-            */
-            for validator in validators {
-                validation->add(name, validator);
-            }
-
-            /**
-             * Get filters in the element
-             */
-            let filters = element->getFilters();
-
-            /**
-             * Assign the filters to the validation
-             */
-            if typeof filters == "array" {
-                validation->setFilters(name, filters);
-            }
-        }
+        /**
+         * The compiled validation is copied, so that the data, entity and
+         * messages of a run do not leak into the next one
+         */
+        let validation = clone this->compileValidation();
 
         /**
         * Perform the validation
@@ -710,6 +780,8 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         if isset this->elements[name] {
             unset this->elements[name];
 
+            this->resetValidation();
+
             return true;
         }
 
@@ -721,6 +793,31 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return false;
     }
 
+    /**
+     * Drops the validation compiled from the elements, so that the next
+     * isValid() compiles it again. The validation shared by the form class
+     * is only dropped when `shared` is true; otherwise a form changed after
+     * it was initialized stops using it and compiles its own
+     */
+    public function resetValidation(bool shared = false) -> <Form>
+    {
+        var plans;
+
+        let this->validationPlan = null;
+
+        if shared {
+            let plans = self::validationPlans;
+
+            unset plans[get_class(this)];
+
+            let self::validationPlans = plans;
+        } elseif this->initialized {
+            let this->ownValidation = true;
+        }
+
+        return this;
+    }
+
     /**
      * Rewinds the internal iterator
      */
@@ -765,6 +862,18 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this;
     }
 
+    /**
+     * Sets the validation the validators of the elements are added to
+     */
+    public function setValidation(var validation) -> <Form>
+    {
+        let this->validation = validation;
+
+        this->resetValidation();
+
+        return this;
+    }
+
     /**
      * Sets an option for the form
      */
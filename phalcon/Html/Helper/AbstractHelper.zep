@@ -110,6 +110,21 @@ abstract class AbstractHelper
     {
         var key, result, value;
 
+        /**
+         * The stock escaper renders all the attributes natively
+         */
+        if get_class(this->escaper) === "Phalcon\\Escaper" {
+            let result = this->escaper->attributes(attributes);
+
+            if result === "" {
+                return result;
+            }
+
+            if result !== false {
+                return substr(result, 1) . " ";
+            }
+        }
+
         let result = "";
         for key, value in attributes {
             if typeof key === "string" && null !== value {
@@ -12,6 +12,7 @@ namespace Phalcon\Http;
 
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Filter\FilterInterface;
 use Phalcon\Helper\Json;
@@ -47,7 +48,7 @@ use stdClass;
  * $request->getLanguages();
  *```
  */
-class Request extends AbstractInjectionAware implements RequestInterface
+class Request extends AbstractInjectionAware implements RequestInterface, ResettableInterface
 {
     private filterService;
 
@@ -1175,6 +1176,18 @@ class Request extends AbstractInjectionAware implements RequestInterface
         return numberFiles;
     }
 
+    /**
+     * Clears the cached raw body and PUT data, so that the next request
+     * handled by a long running worker reads them again
+     */
+    public function reset() -> <RequestInterface>
+    {
+        let this->putCache = null,
+            this->rawBody  = null;
+
+        return this;
+    }
+
     /**
      * Sets automatic sanitizers/filters for a particular field and for
      * particular methods
@@ -23,6 +23,7 @@ use Phalcon\Url\UrlInterface;
 use Phalcon\Mvc\ViewInterface;
 use Phalcon\Http\Response\Headers;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 
@@ -40,7 +41,7 @@ use Phalcon\Events\ManagerInterface;
  * $response->send();
  *```
  */
-class Response implements ResponseInterface, InjectionAwareInterface, EventsAwareInterface
+class Response implements ResponseInterface, InjectionAwareInterface, EventsAwareInterface, ResettableInterface
 {
     protected container;
 
@@ -302,6 +303,22 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
         return this;
     }
+
+    /**
+     * Resets the content, the file to send and the headers of the response,
+     * so that a long running worker can send it again
+     */
+    public function reset() -> <ResponseInterface>
+    {
+        let this->content = null,
+            this->file    = null,
+            this->sent    = false;
+
+        this->getHeaders()->reset();
+
+        return this;
+    }
+
     /**
      * Resets all the established headers
      */
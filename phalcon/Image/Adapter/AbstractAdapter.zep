@@ -31,7 +31,8 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected height { get };
 
-    protected image { get };
+    protected image;
+
     /**
      * Image mime type
      *
@@ -39,8 +40,23 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected mime { get };
 
+    /**
+     * Whether an operation changed the image since it was loaded
+     *
+     * @var bool
+     */
+    protected modified = false;
+
     protected realpath { get };
 
+    /**
+     * Region of the source image (x, y, width, height, source width, source
+     * height) to decode when a deferred image is loaded
+     *
+     * @var array | null
+     */
+    protected region = null;
+
     /**
      * Image type
      *
@@ -77,6 +93,10 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processBackground"}(colors[0], colors[1], colors[2], opacity);
 
         return this;
@@ -93,6 +113,10 @@ abstract class AbstractAdapter implements AdapterInterface
             let radius = 100;
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processBlur"}(radius);
 
         return this;
@@ -107,6 +131,8 @@ abstract class AbstractAdapter implements AdapterInterface
         int offsetX = null,
         int offsetY = null
     ) -> <AdapterInterface> {
+        var region, scaleX, scaleY;
+
         if is_null(offsetX) {
             let offsetX = ((this->width - width) / 2);
         } else {
@@ -139,6 +165,32 @@ abstract class AbstractAdapter implements AdapterInterface
             let height = this->height - offsetY;
         }
 
+        let this->modified = true;
+
+        /**
+         * Deferred images only narrow the region of the source to decode
+         */
+        let region = this->region;
+
+        if typeof region == "array" {
+            let scaleX = region[2] / this->width,
+                scaleY = region[3] / this->height;
+
+            let this->region = [
+                region[0] + offsetX * scaleX,
+                region[1] + offsetY * scaleY,
+                width * scaleX,
+                height * scaleY,
+                region[4],
+                region[5]
+            ];
+
+            let this->width  = width,
+                this->height = height;
+
+            return this;
+        }
+
         this->{"processCrop"}(width, height, offsetX, offsetY);
 
         return this;
@@ -153,12 +205,45 @@ abstract class AbstractAdapter implements AdapterInterface
             let direction = Enum::HORIZONTAL;
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processFlip"}(direction);
 
         return this;
     }
 
 
+    /**
+     * Returns the image resource or object, loading a deferred image
+     */
+    public function getImage()
+    {
+        this->loadImage();
+
+        return this->image;
+    }
+
+    /**
+     * Checks if the image is deferred: resize() and crop() are recorded and
+     * the source is decoded, already resampled, by the first operation that
+     * needs the pixels
+     */
+    public function isDeferred() -> bool
+    {
+        return this->region !== null;
+    }
+
+    /**
+     * Checks if an operation changed the image since it was loaded from its
+     * file, including the resizes and crops recorded by a deferred image
+     */
+    public function isModified() -> bool
+    {
+        return this->modified;
+    }
+
     /**
      * This method scales the images using liquid rescaling method. Only support
      * Imagick
@@ -174,6 +259,10 @@ abstract class AbstractAdapter implements AdapterInterface
         int deltaX = 0,
         int rigidity = 0
     ) -> <AbstractAdapter> {
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processLiquidRescale"}(width, height, deltaX, rigidity);
 
         return this;
@@ -184,6 +273,10 @@ abstract class AbstractAdapter implements AdapterInterface
       */
     public function mask(<AdapterInterface> watermark) -> <AdapterInterface>
     {
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processMask"}(watermark);
 
         return this;
@@ -198,6 +291,10 @@ abstract class AbstractAdapter implements AdapterInterface
             let amount = 2;
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processPixelate"}(amount);
 
         return this;
@@ -211,6 +308,10 @@ abstract class AbstractAdapter implements AdapterInterface
         int opacity = 100,
         bool fadeIn = false
     ) -> <AdapterInterface> {
+        let this->modified = true;
+
+        this->loadImage();
+
         if height <= 0 || height > this->height {
             let height = (int) this->height;
         }
@@ -245,6 +346,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let quality = 100;
         }
 
+        this->loadImage();
+
         return this->{"processRender"}(ext, quality);
     }
 
@@ -336,6 +439,18 @@ abstract class AbstractAdapter implements AdapterInterface
         let width  = (int) max(round(width), 1);
         let height = (int) max(round(height), 1);
 
+        let this->modified = true;
+
+        /**
+         * Deferred images are resampled once, when they are loaded
+         */
+        if this->region !== null {
+            let this->width  = width,
+                this->height = height;
+
+            return this;
+        }
+
         this->{"processResize"}(width, height);
 
         return this;
@@ -359,6 +474,10 @@ abstract class AbstractAdapter implements AdapterInterface
             }
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processRotate"}(degrees);
 
         return this;
@@ -373,6 +492,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let file = (string) this->realpath;
         }
 
+        this->loadImage();
+
         this->{"processSave"}(file, quality);
 
         return this;
@@ -389,6 +510,10 @@ abstract class AbstractAdapter implements AdapterInterface
             let amount = 1;
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processSharpen"}(amount);
 
         return this;
@@ -429,6 +554,10 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processText"}(
             text,
             offsetX,
@@ -477,8 +606,31 @@ abstract class AbstractAdapter implements AdapterInterface
             let opacity = 100;
         }
 
+        let this->modified = true;
+
+        this->loadImage();
+
         this->{"processWatermark"}(watermark, offsetX, offsetY, opacity);
 
         return this;
     }
+
+    /**
+     * Decodes a deferred image, applying the recorded resizes and crops in a
+     * single resample
+     */
+    protected function loadImage() -> void
+    {
+        var region;
+
+        let region = this->region;
+
+        if region === null {
+            return;
+        }
+
+        let this->region = null;
+
+        this->{"processLoad"}(region, this->width, this->height);
+    }
 }
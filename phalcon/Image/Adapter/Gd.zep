@@ -17,8 +17,17 @@ class Gd extends AbstractAdapter
 {
     protected static checked = false;
 
-    public function __construct(string! file, int width = null, int height = null)
-    {
+    /**
+     * Deferred images are only probed for their size: resize() and crop()
+     * are recorded and the file is decoded by the first operation that
+     * needs the pixels
+     */
+    public function __construct(
+        string! file,
+        int width = null,
+        int height = null,
+        bool deferred = false
+    ) {
         var imageinfo;
 
         if !self::checked {
@@ -38,41 +47,18 @@ class Gd extends AbstractAdapter
                 let this->mime = imageinfo["mime"];
             }
 
-            switch this->type {
-                case 1:
-                    let this->image = imagecreatefromgif(this->file);
-                    break;
-
-                case 2:
-                    let this->image = imagecreatefromjpeg(this->file);
-                    break;
-
-                case 3:
-                    let this->image = imagecreatefrompng(this->file);
-                    break;
-
-                case 15:
-                    let this->image = imagecreatefromwbmp(this->file);
-                    break;
-
-                case 16:
-                    let this->image = imagecreatefromxbm(this->file);
-                    break;
-
-                default:
-                    if this->mime {
-                        throw new Exception(
-                            "Installed GD does not support " . this->mime . " images"
-                        );
-                    }
-
-                    throw new Exception(
-                        "Installed GD does not support such images"
-                    );
+            if deferred && in_array(this->type, [1, 2, 3, 15, 16]) {
+                let this->region = [
+                    0,
+                    0,
+                    this->width,
+                    this->height,
+                    this->width,
+                    this->height
+                ];
+            } else {
+                this->processOpen();
             }
-
-            imagesavealpha(this->image, true);
-
         } else {
             if unlikely !width || !height {
                 throw new Exception(
@@ -231,6 +217,43 @@ class Gd extends AbstractAdapter
         }
     }
 
+    protected function processLoad(array region, int width, int height)
+    {
+        var image;
+
+        this->processOpen();
+
+        /**
+         * Nothing to do when the region is the whole source at its size
+         */
+        if region[2] == region[4] && region[3] == region[5] && width == region[4] && height == region[5] {
+            return;
+        }
+
+        /**
+         * GD can not decode at a reduced size, so the recorded crops and
+         * resizes at least share a single resample
+         */
+        let image = this->processCreate(width, height);
+
+        imagecopyresampled(
+            image,
+            this->image,
+            0,
+            0,
+            (int) round(region[0]),
+            (int) round(region[1]),
+            width,
+            height,
+            (int) round(region[2]),
+            (int) round(region[3])
+        );
+
+        imagedestroy(this->image);
+
+        let this->image = image;
+    }
+
     protected function processMask(<AdapterInterface> mask)
     {
         var maskImage, newimage, tempImage, color, index, r, g, b;
@@ -309,6 +332,44 @@ class Gd extends AbstractAdapter
         let this->image = newimage;
     }
 
+    protected function processOpen()
+    {
+        switch this->type {
+            case 1:
+                let this->image = imagecreatefromgif(this->file);
+                break;
+
+            case 2:
+                let this->image = imagecreatefromjpeg(this->file);
+                break;
+
+            case 3:
+                let this->image = imagecreatefrompng(this->file);
+                break;
+
+            case 15:
+                let this->image = imagecreatefromwbmp(this->file);
+                break;
+
+            case 16:
+                let this->image = imagecreatefromxbm(this->file);
+                break;
+
+            default:
+                if this->mime {
+                    throw new Exception(
+                        "Installed GD does not support " . this->mime . " images"
+                    );
+                }
+
+                throw new Exception(
+                    "Installed GD does not support such images"
+                );
+        }
+
+        imagesavealpha(this->image, true);
+    }
+
     protected function processPixelate(int amount)
     {
         var color;
@@ -36,11 +36,17 @@ class Imagick extends AbstractAdapter
 
     /**
      * \Phalcon\Image\Adapter\Imagick constructor
+     *
+     * Deferred images are only pinged for their size: resize() and crop()
+     * are recorded and the file is decoded by the first operation that
+     * needs the pixels, JPEGs directly at the reduced size
      */
-    public function __construct(string! file, int width = null, int height = null)
-    {
-        var image;
-
+    public function __construct(
+        string! file,
+        int width = null,
+        int height = null,
+        bool deferred = false
+    ) {
         if !self::checked {
             self::check();
         }
@@ -52,25 +58,14 @@ class Imagick extends AbstractAdapter
         if file_exists(this->file) {
             let this->realpath = realpath(this->file);
 
-            if unlikely !this->image->readImage(this->realpath) {
-                 throw new Exception(
-                     "Imagick::readImage " . this->file . " failed"
-                 );
-            }
-
-            if !this->image->getImageAlphaChannel() {
-                this->image->setImageAlphaChannel(
-                    constant("Imagick::ALPHACHANNEL_SET")
-                );
-            }
-
-            if this->type == 1 {
-                let image = this->image->coalesceImages();
-
-                this->image->clear();
-                this->image->destroy();
-
-                let this->image = image;
+            if deferred {
+                if unlikely !this->image->pingImage(this->realpath) {
+                    throw new Exception(
+                        "Imagick::pingImage " . this->file . " failed"
+                    );
+                }
+            } else {
+                this->processOpen();
             }
         } else {
             if unlikely (!width || !height) {
@@ -88,13 +83,27 @@ class Imagick extends AbstractAdapter
             this->image->setFormat("png");
             this->image->setImageFormat("png");
 
-            let this->realpath = this->file;
+            let this->realpath = this->file,
+                deferred       = false;
         }
 
         let this->width  = this->image->getImageWidth();
         let this->height = this->image->getImageHeight();
         let this->type   = this->image->getImageType();
         let this->mime   = "image/" . this->image->getImageFormat();
+
+        if deferred {
+            this->image->clear();
+
+            let this->region = [
+                0,
+                0,
+                this->width,
+                this->height,
+                this->width,
+                this->height
+            ];
+        }
     }
 
     /**
@@ -137,6 +146,8 @@ class Imagick extends AbstractAdapter
      */
     public function getInternalImInstance() -> <\Imagick>
     {
+        this->loadImage();
+
         return this->image;
     }
 
@@ -314,6 +325,43 @@ class Imagick extends AbstractAdapter
         let this->height = image->getImageHeight();
     }
 
+    /**
+     * Decodes a deferred image, cropping and resizing it once
+     */
+    protected function processLoad(array region, int width, int height)
+    {
+        var scaleX, scaleY;
+
+        /**
+         * libjpeg can decode straight to a fraction of the size, as long as
+         * it stays above the one needed for the region
+         */
+        if region[2] > width && stripos(this->mime, "jpeg") !== false {
+            this->image->setOption(
+                "jpeg:size",
+                ceil(region[4] * width / region[2]) . "x" . ceil(region[5] * height / region[3])
+            );
+        }
+
+        this->processOpen();
+
+        let scaleX = this->image->getImageWidth() / region[4],
+            scaleY = this->image->getImageHeight() / region[5];
+
+        if region[0] != 0 || region[1] != 0 || region[2] != region[4] || region[3] != region[5] {
+            this->processCrop(
+                (int) max(round(region[2] * scaleX), 1),
+                (int) max(round(region[3] * scaleY), 1),
+                (int) round(region[0] * scaleX),
+                (int) round(region[1] * scaleY)
+            );
+        }
+
+        if this->image->getImageWidth() != width || this->image->getImageHeight() != height {
+            this->processResize(width, height);
+        }
+    }
+
     /**
      * Composite one image onto another
      */
@@ -352,6 +400,35 @@ class Imagick extends AbstractAdapter
         mask->destroy();
     }
 
+    /**
+     * Reads the file, with an alpha channel and GIF frames coalesced
+     */
+    protected function processOpen()
+    {
+        var image;
+
+        if unlikely !this->image->readImage(this->realpath) {
+             throw new Exception(
+                 "Imagick::readImage " . this->file . " failed"
+             );
+        }
+
+        if !this->image->getImageAlphaChannel() {
+            this->image->setImageAlphaChannel(
+                constant("Imagick::ALPHACHANNEL_SET")
+            );
+        }
+
+        if this->type == 1 {
+            let image = this->image->coalesceImages();
+
+            this->image->clear();
+            this->image->destroy();
+
+            let this->image = image;
+        }
+    }
+
     /**
      * Pixelate image
      *
@@ -0,0 +1,387 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Image;
+
+use Phalcon\Image\Adapter\AbstractAdapter;
+use Phalcon\Image\Adapter\AdapterInterface;
+use Phalcon\Storage\Adapter\AbstractAdapter as StorageAbstractAdapter;
+use Phalcon\Storage\Adapter\AdapterInterface as StorageAdapterInterface;
+use Throwable;
+
+/**
+ * Phalcon\Image\Cache
+ *
+ * Stores the images derived from a source file by a chain of operations. The
+ * key covers the source file (path, modification time and size), the chain
+ * and the output format, so that a hit returns the stored image without
+ * decoding the source. Identical requests running at the same time are
+ * processed only once.
+ *
+ *```php
+ * $cache = new \Phalcon\Image\Cache("/var/cache/thumbnails/");
+ *
+ * $path = $cache->getPath(
+ *     "upload/test.jpg",
+ *     [
+ *         ["resize", 200, 200],
+ *         ["crop", 100, 100],
+ *     ],
+ *     "jpg",
+ *     85
+ * );
+ *```
+ */
+class Cache
+{
+    /**
+     * @var string
+     */
+    protected adapter;
+
+    /**
+     * @var string | null
+     */
+    protected directory = null;
+
+    /**
+     * @var ImageFactory
+     */
+    protected factory;
+
+    /**
+     * Adapter methods allowed in a chain
+     *
+     * @var array
+     */
+    protected operations = [
+        "background"    : true,
+        "blur"          : true,
+        "crop"          : true,
+        "flip"          : true,
+        "liquidrescale" : true,
+        "mask"          : true,
+        "pixelate"      : true,
+        "reflection"    : true,
+        "resize"        : true,
+        "rotate"        : true,
+        "sharpen"       : true,
+        "text"          : true,
+        "watermark"     : true
+    ];
+
+    /**
+     * @var StorageAdapterInterface | null
+     */
+    protected storage = null;
+
+    /**
+     * @var int | null
+     */
+    protected ttl = null;
+
+    /**
+     * Phalcon\Image\Cache constructor
+     *
+     * @param StorageAdapterInterface|string $storage A storage adapter or
+     *                                                a directory
+     */
+    public function __construct(
+        var storage,
+        string! adapter = "gd",
+        <ImageFactory> factory = null,
+        var ttl = null
+    ) {
+        if typeof storage == "string" {
+            let this->directory = rtrim(storage, "\\/") . DIRECTORY_SEPARATOR;
+        } elseif storage instanceof StorageAdapterInterface {
+            let this->storage = storage;
+        } else {
+            throw new Exception(
+                "The storage must be a directory or a Phalcon\\Storage\\Adapter\\AdapterInterface"
+            );
+        }
+
+        if factory === null {
+            let factory = new ImageFactory();
+        }
+
+        let this->adapter = adapter,
+            this->factory = factory,
+            this->ttl     = ttl;
+    }
+
+    /**
+     * Loads the source image deferred and applies the chain of operations
+     */
+    public function apply(string! file, array! operations) -> <AdapterInterface>
+    {
+        var image, operation, method, arguments;
+
+        let image = this->factory->newInstance(
+            this->adapter,
+            file,
+            null,
+            null,
+            true
+        );
+
+        for operation in operations {
+            if unlikely typeof operation != "array" || empty operation {
+                throw new Exception("Image operations must be arrays");
+            }
+
+            let method    = operation[0],
+                arguments = array_slice(operation, 1);
+
+            this->checkOperation(method);
+
+            call_user_func_array([image, method], arguments);
+        }
+
+        return image;
+    }
+
+    /**
+     * Returns the key of the image derived from a file
+     */
+    public function getKey(
+        string! file,
+        array! operations,
+        string ext = null,
+        int quality = 100
+    ) -> string {
+        var arguments, argument, chain, operation, realpath;
+        array encoded;
+
+        let realpath = realpath(file);
+
+        if unlikely realpath === false {
+            throw new Exception(
+                "Image file " . file . " does not exist"
+            );
+        }
+
+        if !ext {
+            let ext = pathinfo(file, PATHINFO_EXTENSION);
+        }
+
+        /**
+         * Images passed to mask() or watermark() are encoded by their file,
+         * so they must be unchanged since they were loaded from it
+         */
+        let chain = [];
+
+        for operation in operations {
+            if unlikely typeof operation != "array" || empty operation {
+                throw new Exception("Image operations must be arrays");
+            }
+
+            this->checkOperation(operation[0]);
+
+            let encoded   = [strtolower(operation[0])],
+                arguments = array_slice(operation, 1);
+
+            for argument in arguments {
+                if typeof argument == "object" {
+                    if unlikely !(argument instanceof AbstractAdapter) || !is_file(argument->getRealpath()) {
+                        throw new Exception(
+                            "Image operations only accept images loaded from files as objects"
+                        );
+                    }
+
+                    if unlikely argument->isModified() {
+                        throw new Exception(
+                            "Image operations only accept images that were not modified after they were loaded"
+                        );
+                    }
+
+                    let argument = this->getSourceKey(
+                        argument->getRealpath()
+                    );
+                }
+
+                let encoded[] = argument;
+            }
+
+            let chain[] = encoded;
+        }
+
+        return sha1(
+            serialize(
+                [
+                    this->getSourceKey(realpath),
+                    this->adapter,
+                    chain,
+                    strtolower(ext),
+                    quality
+                ]
+            )
+        );
+    }
+
+    /**
+     * Returns the path of the image derived from a file, processing it when
+     * it is not in the directory yet
+     */
+    public function getPath(
+        string! file,
+        array! operations,
+        string ext = null,
+        int quality = 100
+    ) -> string {
+        var directory, image, key, lockPath, path, pointer, tempPath, e;
+
+        if unlikely this->directory === null {
+            throw new Exception(
+                "Paths are only available when the images are stored in a directory"
+            );
+        }
+
+        if !ext {
+            let ext = pathinfo(file, PATHINFO_EXTENSION);
+        }
+
+        let key       = this->getKey(file, operations, ext, quality),
+            directory = this->directory . substr(key, 0, 2) . DIRECTORY_SEPARATOR,
+            path      = directory . key . "." . strtolower(ext);
+
+        if file_exists(path) {
+            return path;
+        }
+
+        /**
+         * Another request can create the directory at the same time
+         */
+        if !is_dir(directory) && !mkdir(directory, 0777, true) && !is_dir(directory) {
+            throw new Exception("Image cache directory cannot be written");
+        }
+
+        /**
+         * The lock is held while processing, so that the other requests for
+         * the same image wait for it instead of processing it again. The lock
+         * file is kept: removing it would let a request lock a new file while
+         * another one still waits on the removed one
+         */
+        let lockPath = path . ".lock",
+            pointer  = fopen(lockPath, "c");
+
+        if unlikely pointer === false {
+            throw new Exception("Image cache directory cannot be written");
+        }
+
+        flock(pointer, LOCK_EX);
+
+        try {
+            if !file_exists(path) {
+                let image    = this->apply(file, operations),
+                    tempPath = path . "." . uniqid("", true);
+
+                if unlikely file_put_contents(tempPath, image->render(ext, quality)) === false {
+                    throw new Exception("Image cache directory cannot be written");
+                }
+
+                if unlikely !rename(tempPath, path) {
+                    unlink(tempPath);
+
+                    throw new Exception("Image cache directory cannot be written");
+                }
+            }
+        } catch Throwable, e {
+            this->releaseLock(pointer);
+
+            throw e;
+        }
+
+        this->releaseLock(pointer);
+
+        return path;
+    }
+
+    /**
+     * Returns the image derived from a file, processing it when it is not
+     * stored yet
+     */
+    public function render(
+        string! file,
+        array! operations,
+        string ext = null,
+        int quality = 100
+    ) -> string {
+        var cache, data, key;
+
+        if this->directory !== null {
+            return file_get_contents(
+                this->getPath(file, operations, ext, quality)
+            );
+        }
+
+        if !ext {
+            let ext = pathinfo(file, PATHINFO_EXTENSION);
+        }
+
+        let key = this->getKey(file, operations, ext, quality);
+
+        /**
+         * remember() lets a single request process a missing image while
+         * the others wait for it
+         */
+        if this->storage instanceof StorageAbstractAdapter {
+            let cache = this;
+
+            return this->storage->remember(
+                key,
+                this->ttl,
+                function () use (cache, file, operations, ext, quality) {
+                    return cache->apply(file, operations)->render(ext, quality);
+                }
+            );
+        }
+
+        let data = this->storage->get(key);
+
+        if data === null {
+            let data = this->apply(file, operations)->render(ext, quality);
+
+            this->storage->set(key, data, this->ttl);
+        }
+
+        return data;
+    }
+
+    /**
+     * Checks that an operation can be used in a chain
+     */
+    protected function checkOperation(var method) -> void
+    {
+        if unlikely typeof method != "string" || !isset this->operations[strtolower(method)] {
+            throw new Exception(
+                "Image operation is not supported"
+            );
+        }
+    }
+
+    /**
+     * Returns the part of the key identifying a source file
+     */
+    protected function getSourceKey(string! realpath) -> array
+    {
+        return [realpath, filemtime(realpath), filesize(realpath)];
+    }
+
+    /**
+     * Releases the lock
+     */
+    protected function releaseLock(var pointer) -> void
+    {
+        flock(pointer, LOCK_UN);
+        fclose(pointer);
+    }
+}
@@ -33,6 +33,7 @@ class ImageFactory extends AbstractFactory
      *
      * @param array|\Phalcon\Config config = [
      *     'adapter' => 'gd',
+     *     'deferred' => false,
      *     'file' => 'image.jpg',
      *     'height' => null,
      *     'width' => null
@@ -40,7 +41,7 @@ class ImageFactory extends AbstractFactory
      */
     public function load(var config) -> <AdapterInterface>
     {
-        var height, file, name, width;
+        var deferred, height, file, name, width;
 
         let config = this->checkConfig(config);
 
@@ -54,11 +55,12 @@ class ImageFactory extends AbstractFactory
 
         unset config["adapter"];
 
-        let file   = Arr::get(config, "file"),
-            height = Arr::get(config, "height", null),
-            width  = Arr::get(config, "width", null);
+        let deferred = Arr::get(config, "deferred", false),
+            file     = Arr::get(config, "file"),
+            height   = Arr::get(config, "height", null),
+            width    = Arr::get(config, "width", null);
 
-        return this->newInstance(name, file, width, height);
+        return this->newInstance(name, file, width, height, deferred);
     }
 
     /**
@@ -68,7 +70,8 @@ class ImageFactory extends AbstractFactory
         string! name,
         string! file,
         int width = null,
-        int height = null
+        int height = null,
+        bool deferred = false
     ) -> <AdapterInterface>
     {
         var definition;
@@ -82,7 +85,8 @@ class ImageFactory extends AbstractFactory
             [
                 file,
                 width,
-                height
+                height,
+                deferred
             ]
         );
     }
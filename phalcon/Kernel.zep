@@ -15,6 +15,27 @@ namespace Phalcon;
  */
 class Kernel
 {
+    /**
+     * Returns the usage of the process cache of the PHQL, Volt and
+     * annotations parsers (`phalcon.parsers.cache`), since the worker
+     * started
+     *
+     * ```php
+     * [
+     *     "enabled" => true,
+     *     "entries" => 112,
+     *     "bytes"   => 1048576,
+     *     "limit"   => 8388608,
+     *     "hits"    => 5130,
+     *     "misses"  => 112,
+     * ]
+     * ```
+     */
+    public static function getParsersCacheStats() -> array
+    {
+        return phalcon_parsers_cache_stats();
+    }
+
     /**
      * Produces a pre-computed hash key based on a string. This function
      * produces different numbers in 32bit/64bit processors
@@ -12,6 +12,7 @@ namespace Phalcon\Mvc;
 
 use ArrayAccess;
 use Closure;
+use Phalcon\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\Injectable;
 use Phalcon\Di\FactoryDefault;
@@ -26,6 +27,7 @@ use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\Micro\MiddlewareInterface;
 use Phalcon\Mvc\Micro\CollectionInterface;
+use Phalcon\Tag;
 use Throwable;
 
 /**
@@ -1123,6 +1125,39 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
         return route;
     }
 
+    /**
+     * Clears the active handler, the returned value and the per request state
+     * of the shared services and Phalcon\Tag, so that a long running worker
+     * can bootstrap the application once and handle many requests with it.
+     * The registered routes, handlers and middleware are kept
+     *
+     * ```php
+     * while ($uri = $worker->next()) {
+     *     $app->handle($uri);
+     *
+     *     $app->reset();
+     * }
+     * ```
+     */
+    public function reset() -> <Micro>
+    {
+        var container;
+
+        let this->activeHandler = null,
+            this->returnedValue = null,
+            this->stopped       = false;
+
+        let container = this->container;
+
+        if container instanceof Di {
+            container->resetServices();
+        }
+
+        Tag::reset();
+
+        return this;
+    }
+
     /**
      * Sets externally the handler that must be called by the matched route
      *
@@ -10,6 +10,7 @@
 namespace Phalcon\Mvc;
 
 use JsonSerializable;
+use Phalcon\Db\Adapter\AbstractAdapter;
 use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Db\Column;
 use Phalcon\Db\DialectInterface;
@@ -26,6 +27,7 @@ use Phalcon\Mvc\Model\BehaviorInterface;
 use Phalcon\Mvc\Model\Criteria;
 use Phalcon\Mvc\Model\CriteriaInterface;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\MetaDataInterface;
 use Phalcon\Mvc\Model\Query;
@@ -41,6 +43,7 @@ use Phalcon\Mvc\Model\TransactionInterface;
 use Phalcon\Mvc\Model\ValidationFailed;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Validation\ValidationInterface;
+use ReflectionMethod;
 use Serializable;
 
 /**
@@ -131,6 +134,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
 
     protected uniqueTypes;
 
+    /**
+     * Attributes changed by the create events of an upsert, which must not
+     * overwrite an existing row
+     *
+     * @var array | null
+     */
+    protected upsertInsertOnly = null;
+
     /**
      * Phalcon\Mvc\Model constructor
      */
@@ -2060,6 +2071,20 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return count(changedFields) > 0;
     }
 
+    /**
+     * Checks if related records were set through magic properties and are
+     * saved with the record
+     *
+     *```php
+     * $robot->robotsParts = [new RobotsParts()];
+     * var_dump($robot->hasDirtyRelated()); // true
+     *```
+     */
+    public function hasDirtyRelated() -> bool
+    {
+        return count(this->dirtyRelated) > 0;
+    }
+
     /**
      * Checks if the object has internal snapshot data
      */
@@ -2350,8 +2375,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     public function save() -> bool
     {
         var metaData, schema, writeConnection, readConnection, source, table,
-            identityField, exists, success, dirtyRelated;
-        bool hasDirtyRelated;
+            identityField, exists, success, dirtyRelated, insertOnly;
+        bool hasDirtyRelated, upsert, preSaved;
 
         let metaData = this->getModelsMetaData();
 
@@ -2396,9 +2421,16 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let readConnection = this->getReadConnection();
 
         /**
-         * We need to check if the record exists
+         * We need to check if the record exists, unless the model is saved
+         * with an upsert
          */
-        let exists = this->_exists(metaData, readConnection);
+        let upsert = this->canUpsert(metaData, writeConnection);
+
+        if upsert {
+            let exists = false;
+        } else {
+            let exists = this->_exists(metaData, readConnection);
+        }
 
         if exists {
             let this->operationMade = self::OP_UPDATE;
@@ -2417,9 +2449,20 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let identityField = metaData->getIdentityField(this);
 
         /**
-         * _preSave() makes all the validations
+         * _preSave() makes all the validations. An upsert keeps track of the
+         * attributes changed by the create events
          */
-        if this->_preSave(metaData, exists, identityField) === false {
+        if upsert {
+            let this->upsertInsertOnly = [];
+        } else {
+            let this->upsertInsertOnly = null;
+        }
+
+        let preSaved               = this->_preSave(metaData, exists, identityField),
+            insertOnly             = this->upsertInsertOnly,
+            this->upsertInsertOnly = null;
+
+        if preSaved === false {
             /**
              * Rollback the current transaction if there was validation errors
              */
@@ -2447,7 +2490,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * Depending if the record exists we do an update or an insert operation
          */
-        if exists {
+        if upsert {
+            let success = this->_doLowUpsert(
+                metaData,
+                writeConnection,
+                table,
+                insertOnly
+            );
+        } elseif exists {
             let success = this->_doLowUpdate(metaData, writeConnection, table);
         } else {
             let success = this->_doLowInsert(
@@ -2463,6 +2513,15 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          */
         if success {
             let this->dirtyState = self::DIRTY_STATE_PERSISTENT;
+
+            /**
+             * The adapter tells whether the upsert found an existing row, so
+             * that the update events run after it
+             */
+            if upsert && writeConnection->{"lastUpsertInserted"}() === false {
+                let this->operationMade = self::OP_UPDATE,
+                    exists              = true;
+            }
         }
 
         if hasDirtyRelated {
@@ -4002,6 +4061,114 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return success;
     }
 
+    /**
+     * Sends a pre-build INSERT ... ON DUPLICATE KEY UPDATE/ON CONFLICT SQL
+     * statement to the relational database system. Every attribute with a
+     * value is inserted and the non primary ones are updated, except the ones
+     * in insertOnly
+     *
+     * @param string|array table
+     */
+    protected function _doLowUpsert(<MetaDataInterface> metaData, <AdapterInterface> connection, var table, array insertOnly = []) -> bool
+    {
+        var attributeField, attributes, automaticCreateAttributes,
+            automaticUpdateAttributes, bindDataTypes, bindType, bindTypes,
+            columnMap, defaultValue, defaultValues, field, fields, manager,
+            primaryKeys, snapshot, success, unsetDefaultValues, updateFields,
+            value, values;
+
+        let manager                   = <ManagerInterface> this->modelsManager,
+            fields                    = [],
+            values                    = [],
+            bindTypes                 = [],
+            updateFields              = [],
+            snapshot                  = [],
+            unsetDefaultValues        = [],
+            attributes                = metaData->getAttributes(this),
+            primaryKeys               = metaData->getPrimaryKeyAttributes(this),
+            bindDataTypes             = metaData->getBindTypes(this),
+            automaticCreateAttributes = metaData->getAutomaticCreateAttributes(this),
+            automaticUpdateAttributes = metaData->getAutomaticUpdateAttributes(this),
+            defaultValues             = metaData->getDefaultValues(this);
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(this);
+        } else {
+            let columnMap = null;
+        }
+
+        for field in attributes {
+            if typeof columnMap == "array" {
+                if unlikely !fetch attributeField, columnMap[field] {
+                    throw new Exception(
+                        "Column '" . field . "' isn't part of the column map"
+                    );
+                }
+            } else {
+                let attributeField = field;
+            }
+
+            if isset automaticCreateAttributes[attributeField] {
+                continue;
+            }
+
+            /**
+             * Properties that are not defined are left to the database
+             */
+            if !fetch value, this->{attributeField} {
+                continue;
+            }
+
+            if value === null && isset defaultValues[field] {
+                let value = connection->getDefaultValue();
+
+                let snapshot[attributeField]           = defaultValues[field],
+                    unsetDefaultValues[attributeField] = defaultValues[field];
+            } else {
+                let snapshot[attributeField] = value;
+            }
+
+            if unlikely !fetch bindType, bindDataTypes[field] {
+                throw new Exception(
+                    "Column '" . field . "' have not defined a bind data type"
+                );
+            }
+
+            let fields[]    = field,
+                values[]    = value,
+                bindTypes[] = bindType;
+
+            if !in_array(field, primaryKeys) && !isset automaticUpdateAttributes[attributeField] && !isset insertOnly[attributeField] {
+                let updateFields[] = field;
+            }
+        }
+
+        if typeof table === "array" {
+            let table = table[0] . "." . table[1];
+        }
+
+        let success = connection->{"upsert"}(
+            table,
+            values,
+            fields,
+            primaryKeys,
+            updateFields,
+            bindTypes
+        );
+
+        if success {
+            for attributeField, defaultValue in unsetDefaultValues {
+                let this->{attributeField} = defaultValue;
+            }
+
+            if manager->isKeepingSnapshots(this) && globals_get("orm.update_snapshot_on_save") {
+                let this->snapshot = snapshot;
+            }
+        }
+
+        return success;
+    }
+
     /**
      * Checks whether the current record already exists
      */
@@ -4325,86 +4492,131 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     protected final static function _invokeFinder(string method, array arguments)
     {
         var extraMethod, type, modelName, value, model, attributes, field,
-            extraMethodFirst, metaData, params;
-
-        let extraMethod = null;
+            extraMethodFirst, metaData, params, container, manager, finder,
+            query, reflection;
 
         /**
-         * Check if the method starts with "findFirst"
+         * The called class is the model
          */
-        if starts_with(method, "findFirstBy") {
-            let type = "findFirst",
-                extraMethod = substr(method, 11);
-        }
+        let modelName = get_called_class(),
+            container = Di::getDefault(),
+            manager   = null,
+            finder    = null;
 
         /**
-         * Check if the method starts with "find"
+         * Finders resolved before are kept by the models manager
          */
-        elseif starts_with(method, "findBy") {
-            let type = "find",
-                extraMethod = substr(method, 6);
-        }
+        if typeof container == "object" && container->has("modelsManager") {
+            let manager = container->getShared("modelsManager");
 
-        /**
-         * Check if the method starts with "count"
-         */
-        elseif starts_with(method, "countBy") {
-            let type = "count",
-                extraMethod = substr(method, 7);
+            if manager instanceof Manager {
+                let finder = manager->getFinder(modelName, method);
+            } else {
+                let manager = null;
+            }
         }
 
-        /**
-         * The called class is the model
-         */
-        let modelName = get_called_class();
+        if typeof finder != "array" {
+            let extraMethod = null;
 
-        if !extraMethod {
-            return false;
-        }
+            /**
+             * Check if the method starts with "findFirst"
+             */
+            if starts_with(method, "findFirstBy") {
+                let type = "findFirst",
+                    extraMethod = substr(method, 11);
+            }
 
-        if unlikely !isset arguments[0] {
-            throw new Exception(
-                "The static method '" . method . "' requires one argument"
-            );
-        }
+            /**
+             * Check if the method starts with "find"
+             */
+            elseif starts_with(method, "findBy") {
+                let type = "find",
+                    extraMethod = substr(method, 6);
+            }
 
-        let model    = create_instance(modelName),
-            metaData = model->getModelsMetaData();
+            /**
+             * Check if the method starts with "count"
+             */
+            elseif starts_with(method, "countBy") {
+                let type = "count",
+                    extraMethod = substr(method, 7);
+            }
 
-        /**
-         * Get the attributes
-         */
-        let attributes = metaData->getReverseColumnMap(model);
+            if !extraMethod {
+                return false;
+            }
 
-        if typeof attributes != "array" {
-            let attributes = metaData->getDataTypes(model);
-        }
+            if unlikely !isset arguments[0] {
+                throw new Exception(
+                    "The static method '" . method . "' requires one argument"
+                );
+            }
+
+            let model    = create_instance(modelName),
+                metaData = model->getModelsMetaData();
 
-        /**
-         * Check if the extra-method is an attribute
-         */
-        if isset attributes[extraMethod] {
-            let field = extraMethod;
-        } else {
             /**
-             * Lowercase the first letter of the extra-method
+             * Get the attributes
              */
-            let extraMethodFirst = lcfirst(extraMethod);
+            let attributes = metaData->getReverseColumnMap(model);
 
-            if isset attributes[extraMethodFirst] {
-                let field = extraMethodFirst;
+            if typeof attributes != "array" {
+                let attributes = metaData->getDataTypes(model);
+            }
+
+            /**
+             * Check if the extra-method is an attribute
+             */
+            if isset attributes[extraMethod] {
+                let field = extraMethod;
             } else {
                 /**
-                 * Get the possible real method name
+                 * Lowercase the first letter of the extra-method
                  */
-                let field = uncamelize(extraMethod);
+                let extraMethodFirst = lcfirst(extraMethod);
 
-                if unlikely !isset attributes[field] {
-                    throw new Exception(
-                        "Cannot resolve attribute '" . extraMethod . "' in the model"
-                    );
+                if isset attributes[extraMethodFirst] {
+                    let field = extraMethodFirst;
+                } else {
+                    /**
+                     * Get the possible real method name
+                     */
+                    let field = uncamelize(extraMethod);
+
+                    if unlikely !isset attributes[field] {
+                        throw new Exception(
+                            "Cannot resolve attribute '" . extraMethod . "' in the model"
+                        );
+                    }
                 }
             }
+
+            /**
+             * The prepared query can only be reused when the model does not
+             * override find()/findFirst()
+             */
+            let reflection = new ReflectionMethod(modelName, type);
+
+            let finder = [
+                "type"   : type,
+                "field"  : field,
+                "direct" : type != "count" && reflection->class === "Phalcon\\Mvc\\Model",
+                "query"  : null
+            ];
+
+            if manager !== null {
+                manager->setFinder(modelName, method, finder);
+            }
+        } else {
+            if unlikely !isset arguments[0] {
+                throw new Exception(
+                    "The static method '" . method . "' requires one argument"
+                );
+            }
+
+            let type  = finder["type"],
+                field = finder["field"];
         }
 
         /**
@@ -4412,6 +4624,45 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          */
         fetch value, arguments[0];
 
+        /**
+         * Calls with only a value run a copy of the prepared query, binding
+         * the value
+         */
+        if manager !== null && value !== null && finder["direct"] && count(arguments) == 1 {
+            let query = finder["query"];
+
+            if typeof query != "object" {
+                if type == "findFirst" {
+                    let query = static::getPreparedQuery(
+                        [
+                            "conditions" : "[" . field . "] = ?0"
+                        ],
+                        1
+                    );
+
+                    query->setUniqueRow(true);
+                } else {
+                    let query = static::getPreparedQuery(
+                        [
+                            "conditions" : "[" . field . "] = ?0"
+                        ]
+                    );
+                }
+
+                query->parse();
+
+                let finder["query"] = query;
+
+                manager->setFinder(modelName, method, finder);
+            }
+
+            let query = clone query;
+
+            query->setBindParams([value]);
+
+            return query->execute();
+        }
+
         if value !== null {
             let params = [
                  "conditions": "[" . field . "] = ?0",
@@ -4504,7 +4755,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 let eventName = "beforeValidationOnCreate";
             }
 
-            if this->fireEventCancel(eventName) === false {
+            if this->fireOperationEventCancel(eventName) === false {
                 return false;
             }
         }
@@ -4672,7 +4923,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 let eventName = "afterValidationOnCreate";
             }
 
-            if this->fireEventCancel(eventName) === false {
+            if this->fireOperationEventCancel(eventName) === false {
                 return false;
             }
 
@@ -4698,7 +4949,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 let eventName = "beforeCreate";
             }
 
-            if this->fireEventCancel(eventName) === false {
+            if this->fireOperationEventCancel(eventName) === false {
                 return false;
             }
 
@@ -5224,6 +5475,117 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return query;
     }
 
+    /**
+     * Checks if the record can be saved with an upsert: the model uses them,
+     * the dialect supports them, every primary key has a value and the model
+     * doesn't handle the update events or validate. SQLite doesn't report
+     * whether an upsert inserted or updated the row, so its records are
+     * checked for existence instead
+     */
+    protected function canUpsert(<MetaDataInterface> metaData, <AdapterInterface> connection) -> bool
+    {
+        var attributeField, columnMap, customEventsManager, eventName,
+            eventsManager, field, manager, primaryKeys, value;
+
+        if this->dirtyState == self::DIRTY_STATE_PERSISTENT {
+            return false;
+        }
+
+        let manager = this->modelsManager;
+
+        if !(manager instanceof Manager) || !manager->isUsingUpsert(this) {
+            return false;
+        }
+
+        if !(connection instanceof AbstractAdapter) || !connection->{"supportsUpsert"}() {
+            return false;
+        }
+
+        if !in_array(connection->getDialectType(), ["mysql", "postgresql"]) {
+            return false;
+        }
+
+        /**
+         * The create events and validations run before the upsert, so the
+         * update events would be skipped and the validators (e.g.
+         * Uniqueness) would reject existing rows
+         */
+        let eventsManager       = manager->getEventsManager(),
+            customEventsManager = manager->getCustomEventsManager(this);
+
+        for eventName in ["beforeValidationOnUpdate", "validation", "afterValidationOnUpdate", "beforeUpdate"] {
+            if method_exists(this, eventName) {
+                return false;
+            }
+
+            if typeof eventsManager == "object" && eventsManager->hasListeners("model:" . eventName) {
+                return false;
+            }
+
+            if typeof customEventsManager == "object" && customEventsManager->hasListeners("model:" . eventName) {
+                return false;
+            }
+        }
+
+        let primaryKeys = metaData->getPrimaryKeyAttributes(this);
+
+        if !count(primaryKeys) {
+            return false;
+        }
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(this);
+        } else {
+            let columnMap = null;
+        }
+
+        for field in primaryKeys {
+            if typeof columnMap == "array" {
+                if !fetch attributeField, columnMap[field] {
+                    return false;
+                }
+            } else {
+                let attributeField = field;
+            }
+
+            if !fetch value, this->{attributeField} {
+                return false;
+            }
+
+            if value === null || value === "" {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Fires an event of the current operation. During an upsert the
+     * attributes it changes are recorded, so that they are only written when
+     * the row is inserted
+     */
+    protected function fireOperationEventCancel(string! eventName) -> bool
+    {
+        var before, name, value;
+        bool result;
+
+        if typeof this->upsertInsertOnly != "array" {
+            return this->fireEventCancel(eventName);
+        }
+
+        let before = get_object_vars(this),
+            result = this->fireEventCancel(eventName);
+
+        for name, value in get_object_vars(this) {
+            if !array_key_exists(name, before) || before[name] !== value {
+                let this->upsertInsertOnly[name] = true;
+            }
+        }
+
+        return result;
+    }
+
     /**
      * Setup a 1-n relation between two models
      *
@@ -5610,6 +5972,47 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         );
     }
 
+    /**
+     * Sets if the model is saved with an INSERT ... ON DUPLICATE KEY UPDATE
+     * (MySQL) or INSERT ... ON CONFLICT (PostgreSQL, SQLite) statement
+     * instead of checking first if the record exists. Records with a value
+     * for every primary key use it.
+     *
+     * The create events and the behaviors run before the upsert even when
+     * the row exists; the attributes they change are only written when the
+     * row is inserted. afterUpdate and afterSave run when the row existed.
+     * Models with a validation(), beforeValidationOnUpdate(),
+     * afterValidationOnUpdate() or beforeUpdate() method, or listeners for
+     * these events, check if the record exists instead. Behaviors only
+     * receive the create events
+     *
+     *```php
+     * use Phalcon\Mvc\Model;
+     *
+     * class Events extends Model
+     * {
+     *     public function initialize()
+     *     {
+     *         $this->useUpsert(true);
+     *     }
+     * }
+     *```
+     */
+    protected function useUpsert(bool upsert) -> void
+    {
+        var manager;
+
+        let manager = this->modelsManager;
+
+        if unlikely !(manager instanceof Manager) {
+            throw new Exception(
+                "Upserts require the models manager to be a Phalcon\\Mvc\\Model\\Manager"
+            );
+        }
+
+        manager->useUpsert(this, upsert);
+    }
+
     /**
      * Executes validators on every validation call
      *
@@ -16,6 +16,7 @@ use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Mvc\Model\ResultsetInterface;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Mvc\Model\Query;
 use Phalcon\Mvc\Model\QueryInterface;
@@ -49,7 +50,7 @@ use Phalcon\Events\ManagerInterface as EventsManagerInterface;
  * $robot = new Robots($di);
  * ```
  */
-class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareInterface
+class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareInterface, ResettableInterface
 {
     protected aliases = [];
 
@@ -72,6 +73,11 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
     protected customEventsManager = [];
 
+    /**
+     * Magic finders (findFirstBy*, findBy*, countBy*) resolved by model
+     */
+    protected finders = [];
+
     /**
      * Does the model use dynamic update, instead of updating all rows?
      */
@@ -146,6 +152,11 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
     protected schemas = [];
 
+    /**
+     * Does the model save with an upsert instead of checking if it exists?
+     */
+    protected upsert = [];
+
     protected writeConnectionServices = [];
 
     /**
@@ -642,6 +653,20 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->behaviors[entityName][] = behavior;
     }
 
+    /**
+     * Checks if behaviors are bound to a model
+     */
+    public function hasBehaviors(<ModelInterface> model) -> bool
+    {
+        var modelsBehaviors;
+
+        if !fetch modelsBehaviors, this->behaviors[get_class_lower(model)] {
+            return false;
+        }
+
+        return count(modelsBehaviors) > 0;
+    }
+
     /**
      * Sets if a model must keep snapshots
      */
@@ -690,6 +715,29 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return isUsing;
     }
 
+    /**
+     * Sets if a model must be saved with an INSERT ... ON DUPLICATE KEY
+     * UPDATE/ON CONFLICT statement instead of checking first if it exists
+     */
+    public function useUpsert(<ModelInterface> model, bool upsert) -> void
+    {
+        let this->upsert[get_class_lower(model)] = upsert;
+    }
+
+    /**
+     * Checks if a model is saved with an upsert
+     */
+    public function isUsingUpsert(<ModelInterface> model) -> bool
+    {
+        var isUsing;
+
+        if !fetch isUsing, this->upsert[get_class_lower(model)] {
+            return false;
+        }
+
+        return isUsing;
+    }
+
     /**
      * Setup a 1-1 relation between two models
      *
@@ -1633,6 +1681,38 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->reusable = [];
     }
 
+    /**
+     * Returns a magic finder resolved for a model
+     */
+    public function getFinder(string! modelName, string! method) -> array | null
+    {
+        var finder;
+
+        if !fetch finder, this->finders[modelName . "::" . method] {
+            return null;
+        }
+
+        return finder;
+    }
+
+    /**
+     * Stores a magic finder resolved for a model
+     */
+    public function setFinder(string! modelName, string! method, array! finder) -> void
+    {
+        let this->finders[modelName . "::" . method] = finder;
+    }
+
+    /**
+     * Clears the reusable records and the last query. The models
+     * initialization and relations are kept
+     */
+    public function reset() -> void
+    {
+        let this->lastQuery = null,
+            this->reusable  = [];
+    }
+
     /**
      * Gets belongsTo related records from a model
      */
@@ -474,6 +474,40 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
         return count(this->metaData) == 0;
     }
 
+    /**
+     * Loads the meta-data and column maps of all the models stored in a
+     * bundle by warmUp(), with a single read from the adapter. Returns false
+     * if there is no bundle for this version
+     *
+     *```php
+     * $metaData->loadBundle("1.0.3");
+     *```
+     */
+    public function loadBundle(string! version = "") -> bool
+    {
+        var bundle, metaData, columnMap;
+
+        let bundle = this->{"read"}("bundle-" . version);
+
+        if typeof bundle != "array" {
+            return false;
+        }
+
+        if fetch metaData, bundle["meta"] {
+            let this->metaData = array_merge(this->metaData, metaData);
+        }
+
+        if fetch columnMap, bundle["map"] && typeof columnMap == "array" {
+            if typeof this->columnMap == "array" {
+                let columnMap = array_merge(this->columnMap, columnMap);
+            }
+
+            let this->columnMap = columnMap;
+        }
+
+        return true;
+    }
+
     /**
      * Reads metadata from the adapter
      */
@@ -700,6 +734,53 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
         let this->strategy = strategy;
     }
 
+    /**
+     * Reads the meta-data and column maps of the models and stores them all
+     * in one bundle, which is loaded later with loadBundle(). Run it once
+     * after each deploy, so that the workers do not introspect every table
+     * on their first requests
+     *
+     *```php
+     * $metaData->warmUp(
+     *     [
+     *         Customers::class,
+     *         Invoices::class,
+     *     ],
+     *     "1.0.3"
+     * );
+     *```
+     */
+    public function warmUp(array! models, string! version = "") -> array
+    {
+        var container, model, bundle;
+
+        let container = this->container;
+
+        for model in models {
+            if typeof model != "object" {
+                let model = create_instance_params(
+                    model,
+                    [
+                        null,
+                        container
+                    ]
+                );
+            }
+
+            this->readMetaData(model);
+            this->readColumnMap(model);
+        }
+
+        let bundle = [
+            "meta" : this->metaData,
+            "map"  : this->columnMap
+        ];
+
+        this->{"write"}("bundle-" . version, bundle);
+
+        return bundle;
+    }
+
     /**
      * Writes the metadata to adapter
      */
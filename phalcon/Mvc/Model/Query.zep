@@ -25,6 +25,7 @@ use Phalcon\Mvc\Model\Resultset\Simple;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Db\DialectInterface;
 use Phalcon\Mvc\Model\Query\Lang;
+use Throwable;
 
 /**
  * Phalcon\Mvc\Model\Query
@@ -104,9 +105,15 @@ class Query implements QueryInterface, InjectionAwareInterface
     protected sqlColumnAliases = [];
     protected sqlModelsAliases;
     protected type;
+    protected uniqueId = null;
     protected uniqueRow;
     static protected _irPhqlCache;
 
+    /**
+     * Bind types of the last SELECT and their processed version
+     */
+    protected bindTypesLayout = null;
+
     /**
      * TransactionInterface so that the query can wrap a transaction
      * around batch updates and intermediate selects within the transaction.
@@ -2755,7 +2762,8 @@ class Query implements QueryInterface, InjectionAwareInterface
                 if fetch irPhql, self::_irPhqlCache[uniqueId] {
                     if typeof irPhql == "array" {
                         // Assign the type to the query
-                        let this->type = ast["type"];
+                        let this->type     = ast["type"],
+                            this->uniqueId = uniqueId;
 
                         return irPhql;
                     }
@@ -2802,7 +2810,8 @@ class Query implements QueryInterface, InjectionAwareInterface
          * Store the prepared AST in the cache
          */
         if typeof uniqueId == "int" {
-            let self::_irPhqlCache[uniqueId] = irPhql;
+            let self::_irPhqlCache[uniqueId] = irPhql,
+                this->uniqueId                = uniqueId;
         }
 
         let this->intermediate = irPhql;
@@ -2830,13 +2839,25 @@ class Query implements QueryInterface, InjectionAwareInterface
             columnAlias, sqlAlias, dialect, sqlSelect, bindCounts, processed,
             wildcard, value, processedTypes, typeWildcard, result, resultData,
             cache, resultObject, columns1, typesColumnMap, wildcardValue,
-            resultsetClassName;
+            resultsetClassName, cacheId, parsed;
         bool haveObjects, haveScalars, isComplex, isSimpleStd,
             isKeepingSnapshots;
         int numberObjects;
 
         let manager = this->manager;
 
+        /**
+         * Only the statement parsed from the PHQL has a cache id, not the
+         * ones built or set by hand
+         */
+        let cacheId = null;
+
+        if this->uniqueId !== null && fetch parsed, self::_irPhqlCache[this->uniqueId] {
+            if parsed === intermediate {
+                let cacheId = this->uniqueId;
+            }
+        }
+
         /**
          * Get a database connection
          */
@@ -3024,23 +3045,37 @@ class Query implements QueryInterface, InjectionAwareInterface
             }
         }
 
-        let processedTypes = [];
-
         /**
-         * Replace the bind Types
+         * Replace the bind Types. They are processed again only when they
+         * change between executions
          */
-        for typeWildcard, value in bindTypes {
-            if typeof typeWildcard == "integer" {
-                let processedTypes[":" . typeWildcard] = value;
-            } else {
-                let processedTypes[typeWildcard] = value;
+        if this->bindTypesLayout !== null && this->bindTypesLayout[0] === bindTypes {
+            let processedTypes = this->bindTypesLayout[1];
+        } else {
+            let processedTypes = [];
+
+            for typeWildcard, value in bindTypes {
+                if typeof typeWildcard == "integer" {
+                    let processedTypes[":" . typeWildcard] = value;
+                } else {
+                    let processedTypes[typeWildcard] = value;
+                }
             }
+
+            let this->bindTypesLayout = [bindTypes, processedTypes];
         }
 
         if count(bindCounts) {
             let intermediate["bindCounts"] = bindCounts;
         }
 
+        /**
+         * The dialect memoizes the SQL of the parsed statement
+         */
+        if cacheId !== null {
+            let intermediate["cacheId"] = cacheId;
+        }
+
         /**
          * The corresponding SQL dialect generates the SQL statement based
          * accordingly with the database system
@@ -3674,6 +3709,20 @@ class Query implements QueryInterface, InjectionAwareInterface
                 throw new Exception("Cache service must be an object");
             }
 
+            /**
+             * Stampede protection: only one worker executes the query when
+             * the cached resultset expires
+             */
+            if Arr::get(cacheOptions, "remember", false) && method_exists(cache, "remember") {
+                return this->executeRemembered(
+                    cache,
+                    key,
+                    lifetime,
+                    bindParams,
+                    bindTypes
+                );
+            }
+
             let result = cache->get(key);
 
             if !empty result {
@@ -3907,7 +3956,8 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     public function setIntermediate(array! intermediate) -> <QueryInterface>
     {
-        let this->intermediate = intermediate;
+        let this->intermediate = intermediate,
+            this->uniqueId     = null;
 
         return this;
     }
@@ -3974,6 +4024,90 @@ class Query implements QueryInterface, InjectionAwareInterface
         let self::_irPhqlCache = [];
     }
 
+    /**
+     * Executes the query through the `remember()` method of the cache service
+     * so that concurrent workers do not all run it when the cache expires
+     */
+    protected function executeRemembered(
+        var cache,
+        var key,
+        var lifetime,
+        array bindParams,
+        array bindTypes
+    ) {
+        var cacheOptions, e, executed, query, result, uniqueRow;
+
+        this->parse();
+
+        /**
+         * Only PHQL SELECTs can be cached
+         */
+        if unlikely this->type != PHQL_T_SELECT {
+            throw new Exception(
+                "Only PHQL statements that return resultsets can be cached"
+            );
+        }
+
+        /**
+         * The query runs uncached and returns the full resultset inside the
+         * callback
+         */
+        let cacheOptions       = this->cacheOptions,
+            uniqueRow          = this->uniqueRow,
+            query              = this,
+            executed           = new \ArrayObject(),
+            this->cacheOptions = null,
+            this->uniqueRow    = false;
+
+        try {
+            let result = cache->remember(
+                key,
+                lifetime,
+                function () use (query, bindParams, bindTypes, executed) {
+                    var result;
+
+                    let result = query->execute(bindParams, bindTypes);
+
+                    executed->offsetSet("result", result);
+
+                    return result;
+                },
+                cacheOptions
+            );
+        } catch Throwable, e {
+            let this->cacheOptions = cacheOptions,
+                this->uniqueRow    = uniqueRow;
+
+            throw e;
+        }
+
+        let this->cacheOptions = cacheOptions,
+            this->uniqueRow    = uniqueRow,
+            this->cache        = cache;
+
+        if unlikely typeof result != "object" {
+            throw new Exception(
+                "Cache didn't return a valid resultset"
+            );
+        }
+
+        /**
+         * Results not calculated by this call were served from the cache
+         */
+        if !executed->offsetExists("result") || executed->offsetGet("result") !== result {
+            result->setIsFresh(false);
+        }
+
+        /**
+         * Check if only the first row must be returned
+         */
+        if uniqueRow {
+            return result->getFirst();
+        }
+
+        return result;
+    }
+
     /**
      * Gets the read connection from the model if there is no transaction set
      * inside the query object
@@ -76,6 +76,13 @@ abstract class Resultset
 
     protected activeRow = null;
 
+    /**
+     * Number of rows changed by the last delete() or update()
+     *
+     * @var int
+     */
+    protected affectedRows = 0;
+
     protected cache;
 
     protected count;
@@ -180,10 +187,22 @@ abstract class Resultset
     public function delete(<Closure> conditionCallback = null) -> bool
     {
         bool result, transaction;
-        var record, connection = null;
+        var record, bulk, connection = null;
+
+        /**
+         * Without a condition the rows may be deleted with set based queries
+         */
+        if conditionCallback === null {
+            let bulk = this->bulkDelete();
+
+            if bulk !== null {
+                return bulk;
+            }
+        }
 
         let result = true;
         let transaction = false;
+        let this->affectedRows = 0;
 
         this->rewind();
 
@@ -231,10 +250,13 @@ abstract class Resultset
 
                 let result = false;
                 let transaction = false;
+                let this->affectedRows = 0;
 
                 break;
             }
 
+            let this->affectedRows++;
+
             this->next();
         }
 
@@ -297,6 +319,15 @@ abstract class Resultset
         return records;
     }
 
+    /**
+     * Returns the number of rows deleted or updated by the last call to
+     * delete() or update()
+     */
+    public function getAffectedRows() -> int
+    {
+        return this->affectedRows;
+    }
+
     /**
      * Returns the associated cache for the resultset
      */
@@ -570,9 +601,21 @@ abstract class Resultset
     public function update(var data, <Closure> conditionCallback = null) -> bool
     {
         bool transaction;
-        var record, connection = null;
+        var record, bulk, connection = null;
+
+        /**
+         * Without a condition the rows may be updated with set based queries
+         */
+        if conditionCallback === null {
+            let bulk = this->bulkUpdate(data);
+
+            if bulk !== null {
+                return bulk;
+            }
+        }
 
         let transaction = false;
+        let this->affectedRows = 0;
 
         this->rewind();
 
@@ -621,10 +664,13 @@ abstract class Resultset
                 connection->rollback();
 
                 let transaction = false;
+                let this->affectedRows = 0;
 
                 break;
             }
 
+            let this->affectedRows++;
+
             this->next();
         }
 
@@ -645,4 +691,22 @@ abstract class Resultset
     {
         return this->pointer < this->count;
     }
+
+    /**
+     * Deletes the rows with set based queries, returns null when every
+     * record must be deleted on its own
+     */
+    protected function bulkDelete() -> bool | null
+    {
+        return null;
+    }
+
+    /**
+     * Updates the rows with set based queries, returns null when every
+     * record must be saved on its own
+     */
+    protected function bulkUpdate(var data) -> bool | null
+    {
+        return null;
+    }
 }
@@ -15,10 +15,12 @@ use Phalcon\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Mvc\Model\Row;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Storage\Serializer\SerializerInterface;
+use ReflectionMethod;
 
 /**
  * Phalcon\Mvc\Model\Resultset\Simple
@@ -311,4 +313,355 @@ class Simple extends Resultset
             let this->keepSnapshots = keepSnapshots;
         }
     }
+
+    /**
+     * Deletes the rows with a DELETE per 1000 primary keys when no event,
+     * behavior or virtual foreign key is involved
+     */
+    protected function bulkDelete() -> bool | null
+    {
+        var model;
+
+        let model = this->model;
+
+        if !this->canRunBulk(["delete"], ["beforeDelete", "afterDelete", "notDeleted"]) {
+            return null;
+        }
+
+        if globals_get("orm.virtual_foreign_keys") && this->hasForeignKeys(model->getModelsManager()->getHasOneAndHasMany(model)) {
+            return null;
+        }
+
+        return this->runBulk(null, null, null);
+    }
+
+    /**
+     * Updates the rows with an UPDATE per 1000 primary keys when the data
+     * only has scalar values for plain columns and no event, behavior,
+     * setter or virtual foreign key is involved
+     */
+    protected function bulkUpdate(var data) -> bool | null
+    {
+        var attribute, automaticAttributes, bindTypes, column, dataTypeNumeric,
+            defaultValues, emptyStringValues, fields, fieldTypes, metaData,
+            model, notNullAttributes, primaryKeys, reverseColumnMap, value,
+            values;
+        bool notNullValidations;
+
+        if typeof data != "array" || !count(data) {
+            return null;
+        }
+
+        let model = this->model;
+
+        if !this->canRunBulk(["assign", "save"], ["beforeValidation", "beforeValidationOnUpdate", "validation", "afterValidation", "afterValidationOnUpdate", "onValidationFails", "beforeSave", "beforeUpdate", "prepareSave", "afterUpdate", "afterSave", "notSaved"]) {
+            return null;
+        }
+
+        if globals_get("orm.virtual_foreign_keys") && this->hasForeignKeys(model->getModelsManager()->getBelongsTo(model)) {
+            return null;
+        }
+
+        let metaData = model->getModelsMetaData();
+
+        if globals_get("orm.column_renaming") {
+            let reverseColumnMap = metaData->getReverseColumnMap(model);
+        } else {
+            let reverseColumnMap = null;
+        }
+
+        let bindTypes           = metaData->getBindTypes(model),
+            primaryKeys         = metaData->getPrimaryKeyAttributes(model),
+            automaticAttributes = metaData->getAutomaticUpdateAttributes(model),
+            notNullAttributes   = metaData->getNotNullAttributes(model),
+            notNullValidations  = globals_get("orm.not_null_validations"),
+            fields              = [],
+            values              = [],
+            fieldTypes          = [];
+
+        if notNullValidations {
+            let dataTypeNumeric   = metaData->getDataTypesNumeric(model),
+                defaultValues     = metaData->getDefaultValues(model),
+                emptyStringValues = metaData->getEmptyStringAttributes(model);
+        }
+
+        for attribute, value in data {
+            if typeof value == "array" || typeof value == "object" {
+                return null;
+            }
+
+            if typeof reverseColumnMap == "array" {
+                if !fetch column, reverseColumnMap[attribute] {
+                    return null;
+                }
+            } else {
+                let column = attribute;
+            }
+
+            if !isset bindTypes[column] || isset automaticAttributes[column] || in_array(column, primaryKeys) {
+                return null;
+            }
+
+            /**
+             * Values the not null validation of save() would reject
+             */
+            if notNullValidations && in_array(column, notNullAttributes) {
+                if isset dataTypeNumeric[column] {
+                    if !is_numeric(value) {
+                        return null;
+                    }
+                } elseif isset emptyStringValues[column] {
+                    if value === null {
+                        return null;
+                    }
+                } elseif value === null || (value === "" && (!isset defaultValues[column] || value !== defaultValues[column])) {
+                    return null;
+                }
+            }
+
+            /**
+             * assign() calls the setters
+             */
+            if !globals_get("orm.disable_assign_setters") && method_exists(model, "set" . camelize(attribute)) {
+                return null;
+            }
+
+            let fields[]     = column,
+                values[]     = value,
+                fieldTypes[] = bindTypes[column];
+        }
+
+        return this->runBulk(fields, values, fieldTypes);
+    }
+
+    /**
+     * Checks that deleting or saving a record of the model only runs the SQL:
+     * the methods are not overridden and no event is involved
+     */
+    protected function canRunBulk(array methods, array events) -> bool
+    {
+        var eventName, manager, method, model, reflection;
+
+        let model = this->model;
+
+        if typeof model != "object" || !(model instanceof Model) {
+            return false;
+        }
+
+        for method in methods {
+            let reflection = new ReflectionMethod(model, method);
+
+            if reflection->class !== "Phalcon\\Mvc\\Model" {
+                return false;
+            }
+        }
+
+        if !globals_get("orm.events") {
+            return true;
+        }
+
+        for eventName in events {
+            if method_exists(model, eventName) {
+                return false;
+            }
+        }
+
+        let manager = model->getModelsManager();
+
+        if !(manager instanceof Manager) || manager->hasBehaviors(model) {
+            return false;
+        }
+
+        return typeof manager->getEventsManager() != "object" &&
+            typeof manager->getCustomEventsManager(model) != "object";
+    }
+
+    /**
+     * Checks if any of the relations is a virtual foreign key
+     */
+    protected function hasForeignKeys(array relations) -> bool
+    {
+        var relation;
+
+        for relation in relations {
+            if relation->getForeignKey() !== false {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Returns the primary key values of the rows, or null if the rows don't
+     * have the primary key. Rows that are not in memory are fetched one by
+     * one and only their primary key is kept
+     */
+    protected function getPrimaryKeyValues(array primaryKeys) -> array | null
+    {
+        var keys, primaryKey, result, row, rows, values;
+
+        let rows = this->rows;
+
+        if typeof rows != "array" {
+            let result = this->result,
+                keys   = array_flip(primaryKeys),
+                rows   = [];
+
+            if this->row !== null {
+                // re-execute query if required
+                result->execute();
+            }
+
+            loop {
+                let row = result->fetch();
+
+                if typeof row != "array" {
+                    break;
+                }
+
+                let rows[] = array_intersect_key(row, keys);
+            }
+
+            /**
+             * The cursor is at the end: seek() and toArray() execute the
+             * query again
+             */
+            let this->row       = false,
+                this->pointer   = this->count,
+                this->activeRow = null;
+        }
+
+        let keys = [];
+
+        for row in rows {
+            let values = [];
+
+            for primaryKey in primaryKeys {
+                if !array_key_exists(primaryKey, row) {
+                    return null;
+                }
+
+                let values[primaryKey] = row[primaryKey];
+            }
+
+            let keys[] = values;
+        }
+
+        return keys;
+    }
+
+    /**
+     * Runs a DELETE, or an UPDATE of the fields, per chunk of primary keys
+     * in a transaction. Returns null if the rows don't have the primary key
+     */
+    protected function runBulk(var fields, var values, var fieldTypes) -> bool | null
+    {
+        var bindTypes, chunk, conditions, connection, keyConditions, keys,
+            metaData, model, placeholders, primaryKey, primaryKeys, row,
+            schema, source, success, table, value, whereBind, whereTypes,
+            where;
+
+        let model       = this->model,
+            metaData    = model->getModelsMetaData(),
+            primaryKeys = metaData->getPrimaryKeyAttributes(model),
+            bindTypes   = metaData->getBindTypes(model);
+
+        if !count(primaryKeys) {
+            return null;
+        }
+
+        for primaryKey in primaryKeys {
+            if !isset bindTypes[primaryKey] {
+                return null;
+            }
+        }
+
+        let keys = this->getPrimaryKeyValues(primaryKeys);
+
+        if typeof keys != "array" || !count(keys) {
+            return null;
+        }
+
+        let connection = model->getWriteConnection(),
+            schema     = model->getSchema(),
+            source     = model->getSource();
+
+        if schema {
+            let table = [schema, source];
+        } else {
+            let table = source;
+        }
+
+        /**
+         * The update will escape the table name
+         */
+        if typeof fields == "array" && typeof table == "array" {
+            let table = table[0] . "." . table[1];
+        }
+
+        let this->affectedRows = 0;
+
+        connection->begin();
+
+        for chunk in array_chunk(keys, 1000) {
+            let conditions = [],
+                whereBind  = [],
+                whereTypes = [];
+
+            for row in chunk {
+                let keyConditions = [];
+
+                for primaryKey, value in row {
+                    let keyConditions[] = connection->escapeIdentifier(primaryKey) . " = ?",
+                        whereBind[]     = value,
+                        whereTypes[]    = bindTypes[primaryKey];
+                }
+
+                let conditions[] = join(" AND ", keyConditions);
+            }
+
+            if count(primaryKeys) == 1 {
+                let placeholders = array_fill(0, count(whereBind), "?"),
+                    where        = connection->escapeIdentifier(primaryKeys[0]) . " IN (" . join(", ", placeholders) . ")";
+            } else {
+                let where = "(" . join(") OR (", conditions) . ")";
+            }
+
+            if typeof fields == "array" {
+                let success = connection->update(
+                    table,
+                    fields,
+                    values,
+                    [
+                        "conditions": where,
+                        "bind":       whereBind,
+                        "bindTypes":  whereTypes
+                    ],
+                    fieldTypes
+                );
+            } else {
+                let success = connection->delete(
+                    table,
+                    where,
+                    whereBind,
+                    whereTypes
+                );
+            }
+
+            if !success {
+                connection->rollback();
+
+                let this->affectedRows = 0;
+
+                return false;
+            }
+
+            let this->affectedRows += connection->affectedRows();
+        }
+
+        connection->commit();
+
+        return true;
+    }
 }
@@ -0,0 +1,939 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Mvc\Model;
+
+use Countable;
+use Phalcon\Db\RawValue;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\ModelInterface;
+use Throwable;
+
+/**
+ * Phalcon\Mvc\Model\UnitOfWork
+ *
+ * Collects the records to create, update and delete and writes them on
+ * flush() in one transaction per connection:
+ *
+ * - records are inserted with multi-row INSERT statements, parents before
+ *   the models that belong to them
+ * - records are updated with one UPDATE ... CASE statement per group of rows
+ *   (MySQL and SQLite, single column primary keys) or one UPDATE per record
+ * - records are deleted with DELETE ... WHERE pk IN (...) statements,
+ *   children before their parents
+ *
+ * The before*, after* and *Save events run for every record, but the
+ * validations and virtual foreign keys do not. Records without a value for
+ * their identity column are inserted with create(), as the generated ids
+ * can't be read back from a multi-row INSERT, and so are records with
+ * related records set through magic properties, which create() saves and
+ * whose keys it sets. If flush() fails, the dirty state and the identity of
+ * the records to create are restored.
+ *
+ * ```php
+ * use Phalcon\Mvc\Model\UnitOfWork;
+ *
+ * $unitOfWork = new UnitOfWork();
+ *
+ * foreach ($rows as $row) {
+ *     $robot = new Robots();
+ *
+ *     $robot->assign($row);
+ *
+ *     $unitOfWork->create($robot);
+ * }
+ *
+ * $unitOfWork->delete($oldRobot);
+ *
+ * if ($unitOfWork->flush() === false) {
+ *     echo "The robots were not saved";
+ * }
+ * ```
+ */
+class UnitOfWork implements UnitOfWorkInterface, Countable
+{
+    /**
+     * Maximum number of rows written by a statement
+     *
+     * @var int
+     */
+    protected batchSize;
+
+    /**
+     * @var array
+     */
+    protected creates = [];
+
+    /**
+     * @var array
+     */
+    protected deletes = [];
+
+    /**
+     * Dirty state and identity value of the records to create before
+     * flush(), restored when it fails
+     *
+     * @var array
+     */
+    protected previous = [];
+
+    /**
+     * @var array
+     */
+    protected updates = [];
+
+    /**
+     * Records to create that were saved with create() during flush()
+     *
+     * @var array
+     */
+    protected written = [];
+
+    /**
+     * Phalcon\Mvc\Model\UnitOfWork constructor
+     */
+    public function __construct(int batchSize = 500)
+    {
+        if unlikely batchSize < 1 {
+            throw new Exception("The batch size must be greater than zero");
+        }
+
+        let this->batchSize = batchSize;
+    }
+
+    /**
+     * Removes the pending records without writing them
+     */
+    public function clear() -> void
+    {
+        let this->creates = [],
+            this->updates = [],
+            this->deletes = [];
+    }
+
+    /**
+     * Returns the number of pending records
+     */
+    public function count() -> int
+    {
+        return count(this->creates) + count(this->updates) + count(this->deletes);
+    }
+
+    /**
+     * Queues a record to be inserted
+     */
+    public function create(<ModelInterface> model) -> <UnitOfWorkInterface>
+    {
+        var hash;
+
+        let hash = spl_object_hash(model);
+
+        unset this->updates[hash];
+        unset this->deletes[hash];
+
+        let this->creates[hash] = model;
+
+        return this;
+    }
+
+    /**
+     * Queues a record to be deleted. Records queued for creation are just
+     * removed from the queue
+     */
+    public function delete(<ModelInterface> model) -> <UnitOfWorkInterface>
+    {
+        var hash;
+
+        let hash = spl_object_hash(model);
+
+        unset this->updates[hash];
+
+        if isset this->creates[hash] {
+            unset this->creates[hash];
+
+            return this;
+        }
+
+        let this->deletes[hash] = model;
+
+        return this;
+    }
+
+    /**
+     * Writes the pending records. Returns false, with nothing written, if an
+     * event cancels the operation or a statement fails
+     */
+    public function flush() -> bool
+    {
+        var connection, connections, createGroups, deleteGroups, e, events,
+            group, identity, identityField, key, model, saved, updateGroups;
+
+        if !this->count() {
+            return true;
+        }
+
+        let events         = globals_get("orm.events"),
+            saved          = [],
+            this->previous = [],
+            this->written  = [];
+
+        /**
+         * Records inserted by create() run their own events
+         */
+        for key, model in this->creates {
+            if this->needsSave(model) {
+                let saved[key] = true;
+            }
+
+            let identityField = this->getIdentityAttribute(model),
+                identity      = null;
+
+            if identityField !== null {
+                let identity = model->readAttribute(identityField);
+            }
+
+            let this->previous[key] = [
+                "dirtyState":    model->getDirtyState(),
+                "identityField": identityField,
+                "identity":      identity
+            ];
+        }
+
+        /**
+         * The before events of every record run before anything is written
+         */
+        if events {
+            for key, model in this->creates {
+                if isset saved[key] {
+                    continue;
+                }
+
+                if model->fireEventCancel("beforeSave") === false || model->fireEventCancel("beforeCreate") === false {
+                    return false;
+                }
+            }
+
+            for model in this->updates {
+                if model->fireEventCancel("beforeSave") === false || model->fireEventCancel("beforeUpdate") === false {
+                    return false;
+                }
+            }
+
+            for model in this->deletes {
+                if model->fireEventCancel("beforeDelete") === false {
+                    return false;
+                }
+            }
+        }
+
+        let createGroups = this->groupModels(this->creates),
+            updateGroups = this->groupModels(this->updates),
+            deleteGroups = array_reverse(this->groupModels(this->deletes)),
+            connections  = [];
+
+        try {
+            for group in createGroups {
+                let connection  = group["connection"],
+                    connections = this->begin(connections, connection);
+
+                if !this->flushCreates(connection, group["model"], group["models"]) {
+                    this->rollback(connections);
+
+                    return false;
+                }
+            }
+
+            for group in updateGroups {
+                let connection  = group["connection"],
+                    connections = this->begin(connections, connection);
+
+                if !this->flushUpdates(connection, group["model"], group["models"]) {
+                    this->rollback(connections);
+
+                    return false;
+                }
+            }
+
+            for group in deleteGroups {
+                let connection  = group["connection"],
+                    connections = this->begin(connections, connection);
+
+                if !this->flushDeletes(connection, group["model"], group["models"]) {
+                    this->rollback(connections);
+
+                    return false;
+                }
+            }
+        } catch Throwable, e {
+            this->rollback(connections);
+
+            throw e;
+        }
+
+        for connection in connections {
+            connection->commit();
+        }
+
+        for key, model in this->creates {
+            if !isset this->written[key] {
+                this->persisted(model, events, "afterCreate");
+            }
+        }
+
+        for model in this->updates {
+            this->persisted(model, events, "afterUpdate");
+        }
+
+        for model in this->deletes {
+            model->setDirtyState(Model::DIRTY_STATE_DETACHED);
+
+            if events {
+                model->fireEvent("afterDelete");
+            }
+        }
+
+        this->clear();
+
+        let this->previous = [],
+            this->written  = [];
+
+        return true;
+    }
+
+    /**
+     * Queues a record to be updated
+     */
+    public function update(<ModelInterface> model) -> <UnitOfWorkInterface>
+    {
+        var hash;
+
+        let hash = spl_object_hash(model);
+
+        /**
+         * Records queued for creation are inserted with their current values
+         */
+        if isset this->creates[hash] {
+            return this;
+        }
+
+        unset this->deletes[hash];
+
+        let this->updates[hash] = model;
+
+        return this;
+    }
+
+    /**
+     * Begins a transaction on the connection the first time it is used and
+     * returns the connections in a transaction
+     */
+    protected function begin(array! connections, var connection) -> array
+    {
+        var hash;
+
+        let hash = spl_object_hash(connection);
+
+        if !isset connections[hash] {
+            connection->begin();
+
+            let connections[hash] = connection;
+        }
+
+        return connections;
+    }
+
+    /**
+     * Inserts the records with one INSERT per batch of rows
+     */
+    protected function flushCreates(var connection, var model, array! models) -> bool
+    {
+        var attributeField, automaticAttributes, batch, bindDataTypes,
+            bindType, bindTypes, columnMap, defaultValues, escapedFields,
+            field, fields, hash, metaData, placeholders, previous, record,
+            row, rows, table, value, values;
+
+        let metaData            = model->getModelsMetaData(),
+            bindDataTypes       = metaData->getBindTypes(model),
+            automaticAttributes = metaData->getAutomaticCreateAttributes(model),
+            defaultValues       = metaData->getDefaultValues(model),
+            columnMap           = this->getColumnMap(metaData, model),
+            fields              = [],
+            escapedFields       = [],
+            rows                = [];
+
+        for field in metaData->getAttributes(model) {
+            let attributeField = this->getAttributeField(columnMap, field);
+
+            if isset automaticAttributes[attributeField] {
+                continue;
+            }
+
+            if unlikely !isset bindDataTypes[field] {
+                throw new Exception(
+                    "Column '" . field . "' have not defined a bind data type"
+                );
+            }
+
+            let fields[field]   = attributeField,
+                escapedFields[] = connection->escapeIdentifier(field);
+        }
+
+        for record in models {
+            let hash = spl_object_hash(record);
+
+            /**
+             * Records saved with their related records, by create() or by
+             * the create() of another record, are already written
+             */
+            if fetch previous, this->previous[hash] {
+                if record->getDirtyState() == Model::DIRTY_STATE_PERSISTENT && previous["dirtyState"] != Model::DIRTY_STATE_PERSISTENT {
+                    let this->written[hash] = true;
+
+                    continue;
+                }
+            }
+
+            if this->needsSave(record) {
+                let this->written[hash] = true;
+
+                if !record->create() {
+                    return false;
+                }
+
+                continue;
+            }
+
+            let rows[] = record;
+        }
+
+        if !count(rows) {
+            return true;
+        }
+
+        let table = this->getTable(model);
+
+        for batch in array_chunk(rows, this->getBatchSize(connection, count(fields))) {
+            let placeholders = [],
+                values       = [],
+                bindTypes    = [];
+
+            for record in batch {
+                let row = [];
+
+                for field, attributeField in fields {
+                    let value = record->readAttribute(attributeField);
+
+                    if value === null && isset defaultValues[field] {
+                        let value = connection->getDefaultValue();
+                    }
+
+                    if typeof value == "object" && value instanceof RawValue {
+                        let row[] = (string) value;
+                    } elseif value === null {
+                        let row[] = "null";
+                    } else {
+                        if typeof value == "object" {
+                            let value = (string) value;
+                        }
+
+                        let bindType = bindDataTypes[field];
+
+                        let row[]       = "?",
+                            values[]    = value,
+                            bindTypes[] = bindType;
+                    }
+                }
+
+                let placeholders[] = "(" . join(", ", row) . ")";
+            }
+
+            if !connection->execute(
+                "INSERT INTO " . connection->escapeIdentifier(table) . " (" . join(", ", escapedFields) . ") VALUES " . join(", ", placeholders),
+                values,
+                bindTypes
+            ) {
+                return false;
+            }
+
+            /**
+             * Default values from the database are written to the records
+             */
+            for record in batch {
+                for field, value in defaultValues {
+                    if fetch attributeField, fields[field] {
+                        if record->readAttribute(attributeField) === null {
+                            record->writeAttribute(attributeField, value);
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Deletes the records with one DELETE per batch of primary keys
+     */
+    protected function flushDeletes(var connection, var model, array! models) -> bool
+    {
+        var batch, bindDataTypes, columnMap, conditions, field, keyConditions,
+            metaData, placeholders, primaryKeys, record, values, bindTypes;
+
+        let metaData      = model->getModelsMetaData(),
+            primaryKeys   = this->getPrimaryKeys(metaData, model),
+            bindDataTypes = metaData->getBindTypes(model),
+            columnMap     = this->getColumnMap(metaData, model);
+
+        for batch in array_chunk(models, this->getBatchSize(connection, count(primaryKeys))) {
+            let conditions   = [],
+                placeholders = [],
+                values       = [],
+                bindTypes    = [];
+
+            for record in batch {
+                let keyConditions = [];
+
+                for field in primaryKeys {
+                    let keyConditions[] = connection->escapeIdentifier(field) . " = ?",
+                        values[]        = record->readAttribute(this->getAttributeField(columnMap, field)),
+                        bindTypes[]     = bindDataTypes[field];
+                }
+
+                let conditions[]   = join(" AND ", keyConditions),
+                    placeholders[] = "?";
+            }
+
+            if count(primaryKeys) == 1 {
+                let conditions = connection->escapeIdentifier(primaryKeys[0]) . " IN (" . join(", ", placeholders) . ")";
+            } else {
+                let conditions = "(" . join(") OR (", conditions) . ")";
+            }
+
+            if !connection->delete(this->getTable(model), conditions, values, bindTypes) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Updates the records. MySQL and SQLite models with a single column
+     * primary key are updated with one UPDATE ... CASE statement per batch
+     */
+    protected function flushUpdates(var connection, var model, array! models) -> bool
+    {
+        var attributeField, automaticAttributes, batch, bindDataTypes,
+            bindTypes, cases, columnMap, escapedKey, field, fields, keyField,
+            keys, keyType, metaData, placeholders, primaryKeys, record, sets,
+            table, value, values, where, whereTypes, whereValues;
+
+        let metaData            = model->getModelsMetaData(),
+            primaryKeys         = this->getPrimaryKeys(metaData, model),
+            bindDataTypes       = metaData->getBindTypes(model),
+            automaticAttributes = metaData->getAutomaticUpdateAttributes(model),
+            columnMap           = this->getColumnMap(metaData, model),
+            fields              = [];
+
+        for field in metaData->getNonPrimaryKeyAttributes(model) {
+            let attributeField = this->getAttributeField(columnMap, field);
+
+            if isset automaticAttributes[attributeField] {
+                continue;
+            }
+
+            if unlikely !isset bindDataTypes[field] {
+                throw new Exception(
+                    "Column '" . field . "' have not defined a bind data type"
+                );
+            }
+
+            let fields[field] = attributeField;
+        }
+
+        if !count(fields) {
+            return true;
+        }
+
+        let table = this->getTable(model);
+
+        if count(primaryKeys) > 1 || !in_array(connection->getDialectType(), ["mysql", "sqlite"]) {
+            if typeof table == "array" {
+                let table = join(".", table);
+            }
+
+            for record in models {
+                let where       = [],
+                    whereValues = [],
+                    whereTypes  = [],
+                    values      = [],
+                    bindTypes   = [];
+
+                for field in primaryKeys {
+                    let where[]       = connection->escapeIdentifier(field) . " = ?",
+                        whereValues[] = record->readAttribute(this->getAttributeField(columnMap, field)),
+                        whereTypes[]  = bindDataTypes[field];
+                }
+
+                for field, attributeField in fields {
+                    let values[]    = record->readAttribute(attributeField),
+                        bindTypes[] = bindDataTypes[field];
+                }
+
+                if !connection->update(
+                    table,
+                    array_keys(fields),
+                    values,
+                    [
+                        "conditions": join(" AND ", where),
+                        "bind":       whereValues,
+                        "bindTypes":  whereTypes
+                    ],
+                    bindTypes
+                ) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        let keyField   = primaryKeys[0],
+            keyType    = bindDataTypes[keyField],
+            escapedKey = connection->escapeIdentifier(keyField);
+
+        for batch in array_chunk(models, this->getBatchSize(connection, 2 * count(fields) + 1)) {
+            let keys         = [],
+                placeholders = [];
+
+            for record in batch {
+                let keys[]         = record->readAttribute(this->getAttributeField(columnMap, keyField)),
+                    placeholders[] = "?";
+            }
+
+            let sets      = [],
+                values    = [],
+                bindTypes = [];
+
+            for field, attributeField in fields {
+                let cases = [];
+
+                for record in batch {
+                    let value = record->readAttribute(attributeField);
+
+                    let values[]    = record->readAttribute(this->getAttributeField(columnMap, keyField)),
+                        bindTypes[] = keyType;
+
+                    if typeof value == "object" && value instanceof RawValue {
+                        let cases[] = "WHEN ? THEN " . value;
+                    } elseif value === null {
+                        let cases[] = "WHEN ? THEN NULL";
+                    } else {
+                        if typeof value == "object" {
+                            let value = (string) value;
+                        }
+
+                        let cases[]     = "WHEN ? THEN ?",
+                            values[]    = value,
+                            bindTypes[] = bindDataTypes[field];
+                    }
+                }
+
+                let sets[] = connection->escapeIdentifier(field) . " = CASE " . escapedKey . " " . join(" ", cases) . " END";
+            }
+
+            for value in keys {
+                let values[]    = value,
+                    bindTypes[] = keyType;
+            }
+
+            if !connection->execute(
+                "UPDATE " . connection->escapeIdentifier(table) . " SET " . join(", ", sets) . " WHERE " . escapedKey . " IN (" . join(", ", placeholders) . ")",
+                values,
+                bindTypes
+            ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns the attribute of a column
+     */
+    protected function getAttributeField(var columnMap, string! field) -> string
+    {
+        var attributeField;
+
+        if typeof columnMap != "array" {
+            return field;
+        }
+
+        if unlikely !fetch attributeField, columnMap[field] {
+            throw new Exception(
+                "Column '" . field . "' isn't part of the column map"
+            );
+        }
+
+        return attributeField;
+    }
+
+    /**
+     * Returns how many rows fit in a statement, keeping the placeholders
+     * under the limit of the database
+     */
+    protected function getBatchSize(var connection, int placeholdersPerRow) -> int
+    {
+        int maxPlaceholders, rows;
+
+        if connection->getDialectType() == "sqlite" {
+            let maxPlaceholders = 999;
+        } else {
+            let maxPlaceholders = 65535;
+        }
+
+        let rows = (int) floor(maxPlaceholders / max(placeholdersPerRow, 1));
+
+        return max(min(rows, this->batchSize), 1);
+    }
+
+    /**
+     * Returns the column map when column renaming is enabled
+     */
+    protected function getColumnMap(var metaData, var model) -> array | null
+    {
+        if globals_get("orm.column_renaming") {
+            return metaData->getColumnMap(model);
+        }
+
+        return null;
+    }
+
+    /**
+     * Returns the primary key columns, which are required to update or
+     * delete records
+     */
+    protected function getPrimaryKeys(var metaData, var model) -> array
+    {
+        var primaryKeys;
+
+        let primaryKeys = metaData->getPrimaryKeyAttributes(model);
+
+        if unlikely !count(primaryKeys) {
+            throw new Exception(
+                "A primary key must be defined in the model in order to perform the operation"
+            );
+        }
+
+        return primaryKeys;
+    }
+
+    /**
+     * Returns the table of the model, with its schema
+     */
+    protected function getTable(var model) -> string | array
+    {
+        var schema, source;
+
+        let schema = model->getSchema(),
+            source = model->getSource();
+
+        if schema {
+            return [schema, source];
+        }
+
+        return source;
+    }
+
+    /**
+     * Groups the records by model and write connection, with the models
+     * sorted so that the ones referenced by belongsTo() relations come first
+     */
+    protected function groupModels(array! models) -> array
+    {
+        var className, connection, dependencies, dependency, group, groups,
+            key, model, order, pending, ready, referenced, references,
+            relation, sorted;
+        bool blocked;
+
+        let groups       = [],
+            dependencies = [];
+
+        for model in models {
+            let className  = get_class_lower(model),
+                connection = model->getWriteConnection(),
+                key        = className . ":" . spl_object_hash(connection);
+
+            if !isset groups[key] {
+                let groups[key] = [
+                    "className":  className,
+                    "connection": connection,
+                    "model":      model,
+                    "models":     []
+                ];
+            }
+
+            let groups[key]["models"][] = model;
+
+            if !isset dependencies[className] {
+                let dependencies[className] = [];
+
+                for relation in model->getModelsManager()->getBelongsTo(model) {
+                    let referenced = ltrim(strtolower(relation->getReferencedModel()), "\\");
+
+                    if referenced != className {
+                        let dependencies[className][] = referenced;
+                    }
+                }
+            }
+        }
+
+        /**
+         * A model is ready when none of the models it references is pending.
+         * Cycles are written in the order the records were queued
+         */
+        let order   = [],
+            pending = dependencies;
+
+        while count(pending) {
+            let ready = [];
+
+            for className, references in pending {
+                let blocked = false;
+
+                for dependency in references {
+                    if isset pending[dependency] {
+                        let blocked = true;
+
+                        break;
+                    }
+                }
+
+                if !blocked {
+                    let ready[] = className;
+                }
+            }
+
+            if !count(ready) {
+                let ready = array_keys(pending);
+            }
+
+            for className in ready {
+                let order[] = className;
+
+                unset pending[className];
+            }
+        }
+
+        let sorted = [];
+
+        for className in order {
+            for group in groups {
+                if group["className"] == className {
+                    let sorted[] = group;
+                }
+            }
+        }
+
+        return sorted;
+    }
+
+    /**
+     * Returns the attribute of the identity column, if the model has one
+     */
+    protected function getIdentityAttribute(var model) -> string | null
+    {
+        var identityField, metaData;
+
+        let metaData      = model->getModelsMetaData(),
+            identityField = metaData->getIdentityField(model);
+
+        if identityField === false || identityField === null {
+            return null;
+        }
+
+        return this->getAttributeField(
+            this->getColumnMap(metaData, model),
+            identityField
+        );
+    }
+
+    /**
+     * Checks if the record must be inserted with create(): its identity
+     * column has no value or it has related records to save
+     */
+    protected function needsSave(var model) -> bool
+    {
+        var identityField, value;
+
+        if model instanceof Model && model->hasDirtyRelated() {
+            return true;
+        }
+
+        let identityField = this->getIdentityAttribute(model);
+
+        if identityField === null {
+            return false;
+        }
+
+        let value = model->readAttribute(identityField);
+
+        return value === null || value === "";
+    }
+
+    /**
+     * Marks a written record as persistent and fires its after events
+     */
+    protected function persisted(var model, bool events, string eventName) -> void
+    {
+        model->setDirtyState(Model::DIRTY_STATE_PERSISTENT);
+
+        if model->getModelsManager()->isKeepingSnapshots(model) && globals_get("orm.update_snapshot_on_save") {
+            model->setSnapshotData(model->toArray());
+        }
+
+        if events {
+            model->fireEvent(eventName);
+            model->fireEvent("afterSave");
+        }
+    }
+
+    /**
+     * Rolls back the transactions begun by flush() and restores the dirty
+     * state and the identity of the records to create, which create() may
+     * have changed
+     */
+    protected function rollback(array! connections) -> void
+    {
+        var connection, key, model, previous;
+
+        for connection in connections {
+            connection->rollback();
+        }
+
+        for key, previous in this->previous {
+            let model = this->creates[key];
+
+            model->setDirtyState(previous["dirtyState"]);
+
+            if previous["identityField"] !== null {
+                model->writeAttribute(
+                    previous["identityField"],
+                    previous["identity"]
+                );
+            }
+        }
+
+        let this->previous = [],
+            this->written  = [];
+    }
+}
@@ -0,0 +1,46 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Mvc\Model;
+
+use Phalcon\Mvc\ModelInterface;
+
+/**
+ * Phalcon\Mvc\Model\UnitOfWorkInterface
+ *
+ * Interface for Phalcon\Mvc\Model\UnitOfWork
+ */
+interface UnitOfWorkInterface
+{
+    /**
+     * Removes the pending records without writing them
+     */
+    public function clear() -> void;
+
+    /**
+     * Queues a record to be inserted
+     */
+    public function create(<ModelInterface> model) -> <UnitOfWorkInterface>;
+
+    /**
+     * Queues a record to be deleted
+     */
+    public function delete(<ModelInterface> model) -> <UnitOfWorkInterface>;
+
+    /**
+     * Writes the pending records
+     */
+    public function flush() -> bool;
+
+    /**
+     * Queues a record to be updated
+     */
+    public function update(<ModelInterface> model) -> <UnitOfWorkInterface>;
+}
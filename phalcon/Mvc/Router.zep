@@ -12,6 +12,7 @@ namespace Phalcon\Mvc;
 
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Http\RequestInterface;
@@ -48,7 +49,7 @@ use Phalcon\Mvc\Router\RouteInterface;
  * echo $router->getControllerName();
  * ```
  */
-class Router extends AbstractInjectionAware implements RouterInterface, EventsAwareInterface
+class Router extends AbstractInjectionAware implements RouterInterface, EventsAwareInterface, ResettableInterface
 {
     const POSITION_FIRST = 0;
     const POSITION_LAST = 1;
@@ -931,6 +932,24 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         return this;
     }
 
+    /**
+     * Forgets the route matched by the last handled URI. The registered routes
+     * and defaults are kept
+     */
+    public function reset() -> <RouterInterface>
+    {
+        let this->action        = null,
+            this->controller    = null,
+            this->matchedRoute  = null,
+            this->matches       = null,
+            this->module        = null,
+            this->namespaceName = null,
+            this->params        = [],
+            this->wasMatched    = false;
+
+        return this;
+    }
+
     /**
      * Sets the default action name
      */
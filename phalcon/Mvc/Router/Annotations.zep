@@ -13,6 +13,8 @@ namespace Phalcon\Mvc\Router;
 use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\Router;
 use Phalcon\Annotations\Annotation;
+use Phalcon\Storage\Adapter\AdapterInterface;
+use ReflectionClass;
 
 /**
  * Phalcon\Mvc\Router\Annotations
@@ -40,12 +42,40 @@ class Annotations extends Router
 {
     protected actionSuffix = "Action";
 
+    /**
+     * Routes added to the router for each matched resource, so that they
+     * are added once
+     *
+     * @var array
+     */
+    protected addedResources = [];
+
+    /**
+     * @var bool
+     */
+    protected checkSources = false;
+
+    /**
+     * @var array|null
+     */
+    protected compiledResources = null;
+
     protected controllerSuffix = "Controller";
 
     protected handlers = [];
 
     protected routePrefix;
 
+    /**
+     * @var AdapterInterface|null
+     */
+    protected routesCache = null;
+
+    /**
+     * @var string
+     */
+    protected routesVersion = "";
+
     /**
      * Adds a resource to the annotations handler
      * A resource is a class that contains routing annotations
@@ -55,6 +85,8 @@ class Annotations extends Router
     {
         let this->handlers[] = [prefix, handler, module];
 
+        this->resetCompiledResources();
+
         return this;
     }
 
@@ -66,9 +98,22 @@ class Annotations extends Router
     {
         let this->handlers[] = [prefix, handler];
 
+        this->resetCompiledResources();
+
         return this;
     }
 
+    /**
+     * Removes all the pre-defined routes, including the ones added from the
+     * resources
+     */
+    public function clear() -> void
+    {
+        parent::clear();
+
+        let this->addedResources = [];
+    }
+
     /**
      * Return the registered resources
      */
@@ -82,56 +127,30 @@ class Annotations extends Router
      */
     public function handle(string! uri) -> void
     {
-        var annotationsService, handlers, controllerSuffix, scope, prefix,
-            route, compiledPattern, container, handler, controllerName,
-            lowerControllerName, namespaceName, moduleName, handlerAnnotations,
-            classAnnotations, annotations, annotation, methodAnnotations, method,
-            collection;
-        string sufixed;
-
-        let container = <DiInterface> this->container;
-
-        if unlikely typeof container != "object" {
-            throw new Exception(
-                Exception::containerServiceNotFound("the 'annotations' service")
-            );
-        }
+        var index, resource, prefix, compiledPattern, definitions, definition,
+            routes;
 
-        let annotationsService = container->getShared("annotations");
-
-        let handlers = this->handlers;
-
-        let controllerSuffix = this->controllerSuffix;
-
-        for scope in handlers {
-            if typeof scope != "array" {
+        for index, resource in this->getCompiledResources() {
+            /**
+             * The routes of a resource are only added on its first match
+             */
+            if isset this->addedResources[index] {
                 continue;
             }
 
             /**
              * A prefix (if any) must be in position 0
              */
-            let prefix = scope[0];
+            let prefix = resource[0];
 
             if !empty prefix {
                 /**
-                 * Route object is used to compile patterns
+                 * The compiled prefix is only kept when it is a regular
+                 * expression
                  */
-                let route = new Route(prefix);
+                let compiledPattern = resource[1];
 
-                /**
-                 * Compiled patterns can be valid regular expressions.
-                 * In that case We only need to theck if it starts with
-                 * the pattern so we remove to "$" from the end.
-                 */
-                let compiledPattern = str_replace(
-                    "$#", "#", route->getCompiledPattern()
-                );
-
-                if memstr(compiledPattern, "^") {
-                    /**
-                     * If it's a regular expression, it will contain the "^"
-                     */
+                if compiledPattern !== null {
                     if !preg_match(compiledPattern, uri) {
                         continue;
                     }
@@ -141,91 +160,27 @@ class Annotations extends Router
             }
 
             /**
-             * The controller must be in position 1
-             */
-            let handler = scope[1];
-
-            if memstr(handler, "\\") {
-                /**
-                 * Extract the real class name from the namespaced class
-                 * The lowercased class name is used as controller
-                 * Extract the namespace from the namespaced class
-                 */
-                let controllerName = get_class_ns(handler),
-                    namespaceName = get_ns_class(handler);
-            } else {
-                let controllerName = handler;
-
-                fetch namespaceName, this->defaultNamespace;
-            }
-
-            let this->routePrefix = null;
-
-            /**
-             * Check if the scope has a module associated
-             */
-            fetch moduleName, scope[2];
-
-            let sufixed = controllerName . controllerSuffix;
-
-            /**
-             * Add namespace to class if one is set
-             */
-            if namespaceName !== null {
-                let sufixed = namespaceName . "\\" . sufixed;
-            }
-
-            /**
-             * Get the annotations from the class
+             * Without a routes cache the annotations of a resource are only
+             * read once its prefix matches
              */
-            let handlerAnnotations = annotationsService->get(sufixed);
-
-            if typeof handlerAnnotations != "object" {
-                continue;
+            let definitions = resource[2];
+
+            if definitions === null {
+                let definitions = this->compileResource(resource[3])["definitions"],
+                    this->compiledResources[index] = [
+                        prefix,
+                        resource[1],
+                        definitions
+                    ];
             }
 
-            /**
-             * Process class annotations
-             */
-            let classAnnotations = handlerAnnotations->getClassAnnotations();
+            let routes = [];
 
-            if typeof classAnnotations == "object" {
-                let annotations = classAnnotations->getAnnotations();
-
-                if typeof annotations == "array" {
-                    for annotation in annotations {
-                        this->processControllerAnnotation(
-                            controllerName,
-                            annotation
-                        );
-                    }
-                }
+            for definition in definitions {
+                let routes[] = this->addCompiledRoute(definition);
             }
 
-            /**
-             * Process method annotations
-             */
-            let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
-
-            if typeof methodAnnotations == "array" {
-                let lowerControllerName = uncamelize(controllerName);
-
-                for method, collection in methodAnnotations {
-                    if typeof collection != "object" {
-                        continue;
-                    }
-
-                    for annotation in collection->getAnnotations() {
-                        this->processActionAnnotation(
-                            moduleName,
-                            namespaceName,
-                            lowerControllerName,
-                            method,
-                            annotation
-                        );
-                    }
-                }
-            }
+            let this->addedResources[index] = routes;
         }
 
         /**
@@ -394,6 +349,8 @@ class Annotations extends Router
     public function setActionSuffix(string! actionSuffix)
     {
         let this->actionSuffix = actionSuffix;
+
+        this->resetCompiledResources();
     }
 
     /**
@@ -402,5 +359,414 @@ class Annotations extends Router
     public function setControllerSuffix(string! controllerSuffix)
     {
         let this->controllerSuffix = controllerSuffix;
+
+        this->resetCompiledResources();
+    }
+
+    /**
+     * Stores the route table expanded from the annotations in a storage
+     * adapter, so that the annotations are only read when the table is
+     * built. The cache entry is invalidated by changing the version, the
+     * registered resources or, when checkSources is enabled, the
+     * modification time of the controller files
+     *
+     * ```php
+     * $router->setRoutesCache(
+     *     $container->getShared("modelsCache"),
+     *     "1.0.3"
+     * );
+     * ```
+     */
+    public function setRoutesCache(<AdapterInterface> routesCache, string! version = "", bool checkSources = false) -> <Annotations>
+    {
+        let this->routesCache   = routesCache,
+            this->routesVersion = version,
+            this->checkSources  = checkSources;
+
+        this->resetCompiledResources();
+
+        return this;
+    }
+
+    /**
+     * Adds a route from its compiled definition
+     */
+    protected function addCompiledRoute(array! definition) -> <RouteInterface>
+    {
+        var route, converters, param, converter, beforeMatch, name, hostname;
+
+        let route = this->add(
+            definition["pattern"],
+            definition["paths"],
+            definition["httpMethods"]
+        );
+
+        if fetch converters, definition["converters"] && typeof converters == "array" {
+            for param, converter in converters {
+                route->convert(param, converter);
+            }
+        }
+
+        if fetch beforeMatch, definition["beforeMatch"] && beforeMatch !== null {
+            route->beforeMatch(beforeMatch);
+        }
+
+        if fetch name, definition["name"] && name !== null {
+            route->setName(name);
+        }
+
+        if fetch hostname, definition["hostname"] && hostname !== null {
+            route->setHostname(hostname);
+        }
+
+        return route;
+    }
+
+    /**
+     * Compiles the prefix of a resource, returning null when it is not a
+     * regular expression
+     */
+    protected function compilePrefix(var prefix) -> string | null
+    {
+        var route, compiledPattern;
+
+        if empty prefix {
+            return null;
+        }
+
+        /**
+         * Route object is used to compile patterns
+         */
+        let route = new Route(prefix);
+
+        /**
+         * Compiled patterns can be valid regular expressions.
+         * In that case We only need to theck if it starts with
+         * the pattern so we remove to "$" from the end.
+         */
+        let compiledPattern = str_replace(
+            "$#", "#", route->getCompiledPattern()
+        );
+
+        /**
+         * If it's a regular expression, it will contain the "^"
+         */
+        if !memstr(compiledPattern, "^") {
+            return null;
+        }
+
+        return compiledPattern;
+    }
+
+    /**
+     * Reads the annotations of a resource and returns its route
+     * definitions, along with its controller file when the sources are
+     * checked
+     */
+    protected function compileResource(array! scope) -> array
+    {
+        var annotationsService, controllerSuffix, route, container, handler,
+            controllerName, lowerControllerName, namespaceName, moduleName,
+            handlerAnnotations, classAnnotations, annotations, annotation,
+            methodAnnotations, method, collection, routes, definitions,
+            reflection, fileName, source;
+        string sufixed;
+
+        let container = <DiInterface> this->container;
+
+        if unlikely typeof container != "object" {
+            throw new Exception(
+                Exception::containerServiceNotFound("the 'annotations' service")
+            );
+        }
+
+        let annotationsService = container->getShared("annotations"),
+            controllerSuffix   = this->controllerSuffix,
+            definitions        = [],
+            source             = null;
+
+        /**
+         * The controller must be in position 1
+         */
+        let handler = scope[1];
+
+        if memstr(handler, "\\") {
+            /**
+             * Extract the real class name from the namespaced class
+             * The lowercased class name is used as controller
+             * Extract the namespace from the namespaced class
+             */
+            let controllerName = get_class_ns(handler),
+                namespaceName = get_ns_class(handler);
+        } else {
+            let controllerName = handler;
+
+            fetch namespaceName, this->defaultNamespace;
+        }
+
+        /**
+         * Check if the scope has a module associated
+         */
+        fetch moduleName, scope[2];
+
+        let sufixed = controllerName . controllerSuffix;
+
+        /**
+         * Add namespace to class if one is set
+         */
+        if namespaceName !== null {
+            let sufixed = namespaceName . "\\" . sufixed;
+        }
+
+        /**
+         * Get the annotations from the class
+         */
+        let handlerAnnotations = annotationsService->get(sufixed);
+
+        if typeof handlerAnnotations != "object" {
+            return [
+                "definitions" : definitions,
+                "source"      : source
+            ];
+        }
+
+        if this->checkSources {
+            let reflection = new ReflectionClass(sufixed),
+                fileName   = reflection->getFileName();
+
+            if fileName {
+                let source = fileName;
+            }
+        }
+
+        /**
+         * The routes are collected in an empty table and restored afterwards
+         */
+        let routes            = this->routes,
+            this->routePrefix = null,
+            this->routes      = [];
+
+        /**
+         * Process class annotations
+         */
+        let classAnnotations = handlerAnnotations->getClassAnnotations();
+
+        if typeof classAnnotations == "object" {
+            let annotations = classAnnotations->getAnnotations();
+
+            if typeof annotations == "array" {
+                for annotation in annotations {
+                    this->processControllerAnnotation(
+                        controllerName,
+                        annotation
+                    );
+                }
+            }
+        }
+
+        /**
+         * Process method annotations
+         */
+        let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
+
+        if typeof methodAnnotations == "array" {
+            let lowerControllerName = uncamelize(controllerName);
+
+            for method, collection in methodAnnotations {
+                if typeof collection != "object" {
+                    continue;
+                }
+
+                for annotation in collection->getAnnotations() {
+                    this->processActionAnnotation(
+                        moduleName,
+                        namespaceName,
+                        lowerControllerName,
+                        method,
+                        annotation
+                    );
+                }
+            }
+        }
+
+        for route in this->routes {
+            let definitions[] = [
+                "pattern"     : route->getPattern(),
+                "paths"       : route->getPaths(),
+                "httpMethods" : route->getHttpMethods(),
+                "converters"  : route->getConverters(),
+                "beforeMatch" : route->getBeforeMatch(),
+                "name"        : route->getName(),
+                "hostname"    : route->getHostname()
+            ];
+        }
+
+        let this->routes = routes;
+
+        return [
+            "definitions" : definitions,
+            "source"      : source
+        ];
+    }
+
+    /**
+     * Reads the annotations of every registered resource and returns the
+     * expanded route table, along with the controller files when the
+     * sources are checked
+     */
+    protected function compileResources() -> array
+    {
+        var scope, prefix, compiled, fileName, resources, sources;
+
+        let resources = [],
+            sources   = [];
+
+        for scope in this->handlers {
+            if typeof scope != "array" {
+                continue;
+            }
+
+            /**
+             * A prefix (if any) must be in position 0
+             */
+            let prefix   = scope[0],
+                compiled = this->compileResource(scope),
+                fileName = compiled["source"];
+
+            if fileName !== null {
+                let sources[fileName] = filemtime(fileName);
+            }
+
+            let resources[] = [
+                prefix,
+                this->compilePrefix(prefix),
+                compiled["definitions"]
+            ];
+        }
+
+        return [
+            "resources" : resources,
+            "sources"   : sources
+        ];
+    }
+
+    /**
+     * Returns the route table of the registered resources, building it or
+     * reading it from the routes cache when needed
+     */
+    protected function getCompiledResources() -> array
+    {
+        var routesCache, cacheKey, compiled, fileName, modified, resources,
+            scope;
+        bool fresh;
+
+        if this->compiledResources !== null {
+            return this->compiledResources;
+        }
+
+        let routesCache = this->routesCache;
+
+        /**
+         * Without a routes cache only the prefixes are compiled here; the
+         * annotations of a resource are read by handle() on its first match
+         */
+        if typeof routesCache != "object" {
+            let resources = [];
+
+            for scope in this->handlers {
+                if typeof scope != "array" {
+                    continue;
+                }
+
+                let resources[] = [
+                    scope[0],
+                    this->compilePrefix(scope[0]),
+                    null,
+                    scope
+                ];
+            }
+
+            let this->compiledResources = resources;
+
+            return resources;
+        }
+
+        let cacheKey = "router-annotations-" . md5(
+            serialize(
+                [
+                    this->routesVersion,
+                    this->handlers,
+                    this->actionSuffix,
+                    this->controllerSuffix,
+                    this->defaultNamespace
+                ]
+            )
+        );
+
+        let compiled = routesCache->get(cacheKey);
+
+        if typeof compiled == "array" && isset compiled["resources"] {
+            let fresh = true;
+
+            if this->checkSources {
+                for fileName, modified in compiled["sources"] {
+                    if !file_exists(fileName) || filemtime(fileName) != modified {
+                        let fresh = false;
+
+                        break;
+                    }
+                }
+            }
+
+            if fresh {
+                let this->compiledResources = compiled["resources"];
+
+                return this->compiledResources;
+            }
+        }
+
+        let compiled = this->compileResources();
+
+        routesCache->set(cacheKey, compiled);
+
+        let this->compiledResources = compiled["resources"];
+
+        return this->compiledResources;
+    }
+
+    /**
+     * Drops the compiled resources and removes the routes added from them,
+     * so that they are compiled and added again
+     */
+    protected function resetCompiledResources() -> void
+    {
+        var added, route, routes;
+
+        let this->compiledResources = null;
+
+        if empty this->addedResources {
+            return;
+        }
+
+        let added = [];
+
+        for routes in this->addedResources {
+            for route in routes {
+                let added[spl_object_hash(route)] = true;
+            }
+        }
+
+        let routes = [];
+
+        for route in this->routes {
+            if !isset added[spl_object_hash(route)] {
+                let routes[] = route;
+            }
+        }
+
+        let this->routes         = routes,
+            this->addedResources = [],
+            this->keyRouteIds    = [],
+            this->keyRouteNames  = [];
     }
 }
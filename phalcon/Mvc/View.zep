@@ -13,6 +13,7 @@ namespace Phalcon\Mvc;
 use Closure;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\Injectable;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Helper\Arr;
 use Phalcon\Helper\Str;
@@ -46,7 +47,7 @@ use Phalcon\Mvc\View\Engine\Php as PhpEngine;
  * echo $view->getContent();
  * ```
  */
-class View extends Injectable implements ViewInterface, EventsAwareInterface
+class View extends Injectable implements ViewInterface, EventsAwareInterface, ResettableInterface
 {
     /**
      * Render Level: To the action view
@@ -645,8 +646,10 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
             this->engines         = false,
             this->renderLevel     = self::LEVEL_MAIN_LAYOUT,
             this->content         = null,
+            this->pickView        = null,
             this->templatesBefore = [],
-            this->templatesAfter  = [];
+            this->templatesAfter  = [],
+            this->viewParams      = [];
 
         return this;
     }
@@ -16,7 +16,9 @@ use Phalcon\Helper\Arr;
 use Phalcon\Helper\Str;
 use Phalcon\Storage\Exception;
 use Phalcon\Storage\SerializerFactory;
+use Phalcon\Storage\Serializer\AbstractSerializer;
 use Phalcon\Storage\Serializer\SerializerInterface;
+use Throwable;
 
 abstract class AbstractAdapter implements AdapterInterface
 {
@@ -122,11 +124,149 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     abstract public function increment(string! key, int value = 1) -> int | bool;
 
+    /**
+     * Acquires a short lived lock for a key. Returns false if the lock is
+     * already held by someone else.
+     *
+     * This default implementation is not atomic; adapters that can offer an
+     * atomic "add" operation override it.
+     */
+    public function lock(string! key, int ttl = 30) -> bool
+    {
+        var lockKey;
+
+        let lockKey = this->getLockKey(key);
+
+        if this->has(lockKey) {
+            return false;
+        }
+
+        return this->set(lockKey, 1, ttl);
+    }
+
+    /**
+     * Returns the value stored for a key. If it is missing it is calculated
+     * using the callback and stored for `ttl`. Only one worker at a time
+     * recalculates a key; the others either serve the (stale) value they
+     * have or wait for the recalculated one.
+     *
+     * The item can be recalculated before it expires (probabilistic early
+     * expiration), based on how long the callback took to run the last time.
+     * A `beta` greater than 1.0 favors earlier recalculation, 0 disables it.
+     *
+     * ```php
+     * $robots = $adapter->remember(
+     *     "robots",
+     *     3600,
+     *     function () {
+     *         return Robots::find()->toArray();
+     *     },
+     *     [
+     *         "stale" => 60,
+     *     ]
+     * );
+     * ```
+     *
+     * @param array options = [
+     *     'beta'    => 1.0,
+     *     'lockTtl' => 30,
+     *     'stale'   => 0,
+     *     'wait'    => 1000
+     * ]
+     */
+    public function remember(string! key, var ttl, var callback, array! options = []) -> var
+    {
+        var fresh, meta, metaKey, value;
+        float beta, now;
+        int lockTtl, stale, wait, waited;
+
+        let beta     = (float) Arr::get(options, "beta", 1.0),
+            lockTtl  = (int) Arr::get(options, "lockTtl", 30),
+            stale    = (int) Arr::get(options, "stale", 0),
+            wait     = (int) Arr::get(options, "wait", 1000),
+            metaKey  = this->getRememberKey(key),
+            meta     = this->get(metaKey),
+            now      = microtime(true);
+
+        /**
+         * The value is stored as it is under the key, so that get() returns
+         * it, and the timings of the calculation under a derived key
+         */
+        if this->isRememberMeta(meta) && this->has(key) {
+            let value = this->get(key);
+
+            /**
+             * XFetch: recalculate early with a probability that grows as the
+             * expiration time approaches
+             */
+            if (now - meta["delta"] * beta * log(mt_rand(1, mt_getrandmax()) / mt_getrandmax())) < meta["expires"] {
+                return value;
+            }
+
+            /**
+             * Someone else is already recalculating this item. Serve the
+             * value we have while it is within its grace period
+             */
+            if now < (meta["expires"] + stale) {
+                if !this->lock(key, lockTtl) {
+                    return value;
+                }
+
+                return this->recalculate(key, ttl, stale, callback, true);
+            }
+        }
+
+        if this->lock(key, lockTtl) {
+            /**
+             * The worker that held the lock before may have stored the value
+             * after it was read
+             */
+            let fresh = this->get(metaKey);
+
+            if this->isRememberMeta(fresh) && fresh != meta && this->has(key) {
+                let value = this->get(key);
+
+                this->unlock(key);
+
+                return value;
+            }
+
+            return this->recalculate(key, ttl, stale, callback, true);
+        }
+
+        /**
+         * Another worker is calculating the value - wait for it
+         */
+        let waited = 0;
+        while waited < wait {
+            usleep(10000);
+
+            let waited += 10,
+                meta   = this->get(metaKey);
+
+            if this->isRememberMeta(meta) && this->has(key) {
+                return this->get(key);
+            }
+        }
+
+        return this->recalculate(key, ttl, stale, callback, false);
+    }
+
     /**
      * Stores data in the adapter
      */
     abstract public function set(string! key, var value, var ttl = null) -> bool;
 
+    /**
+     * Releases a lock acquired with lock()
+     */
+    public function unlock(string! key) -> bool
+    {
+        return this->delete(
+            this->getLockKey(key)
+        );
+    }
+
     /**
      * Filters the keys array based on global and passed prefix
      *
@@ -153,6 +293,22 @@ abstract class AbstractAdapter implements AdapterInterface
         return results;
     }
 
+    /**
+     * Returns the key used to lock an item
+     */
+    protected function getLockKey(string! key) -> string
+    {
+        return key . ".lock";
+    }
+
+    /**
+     * Returns the key storing the timings of a value stored by remember()
+     */
+    protected function getRememberKey(string! key) -> string
+    {
+        return key . ".remember";
+    }
+
     /**
      * Returns the key requested, prefixed
      */
@@ -169,6 +325,10 @@ abstract class AbstractAdapter implements AdapterInterface
     protected function getSerializedData(var content) -> var
     {
         if this->defaultSerializer !== "" {
+            if this->serializer instanceof AbstractSerializer {
+                return this->serializer->encode(content);
+            }
+
             this->serializer->setData(content);
             let content = this->serializer->serialize();
         }
@@ -210,6 +370,10 @@ abstract class AbstractAdapter implements AdapterInterface
         }
 
         if this->defaultSerializer !== "" {
+            if this->serializer instanceof AbstractSerializer {
+                return this->serializer->decode(content);
+            }
+
             this->serializer->unserialize(content);
             let content = this->serializer->getData();
         }
@@ -217,6 +381,63 @@ abstract class AbstractAdapter implements AdapterInterface
         return content;
     }
 
+    /**
+     * Checks if a stored value has been written by remember()
+     */
+    protected function isRememberMeta(var meta) -> bool
+    {
+        return typeof meta === "array" &&
+            isset meta["delta"] &&
+            isset meta["expires"];
+    }
+
+    /**
+     * Calculates the value for remember(), stores it and releases the lock
+     */
+    protected function recalculate(
+        string! key,
+        var ttl,
+        int stale,
+        var callback,
+        bool locked
+    ) -> var {
+        var e, value;
+        float start, now;
+        int lifetime;
+
+        let start = microtime(true);
+
+        try {
+            let value = call_user_func(callback);
+        } catch Throwable, e {
+            if locked {
+                this->unlock(key);
+            }
+
+            throw e;
+        }
+
+        let now      = microtime(true),
+            lifetime = this->getTtl(ttl);
+
+        this->set(key, value, lifetime + stale);
+
+        this->set(
+            this->getRememberKey(key),
+            [
+                "delta"   : now - start,
+                "expires" : now + lifetime
+            ],
+            lifetime + stale
+        );
+
+        if locked {
+            this->unlock(key);
+        }
+
+        return value;
+    }
+
     /**
      * Initializes the serializer
      */
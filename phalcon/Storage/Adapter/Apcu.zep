@@ -176,6 +176,23 @@ class Apcu extends AbstractAdapter
         return apcu_inc(this->getPrefixedKey(key), value);
     }
 
+    /**
+     * Acquires a lock for a key using the atomic `apcu_add()`
+     *
+     * @param string $key
+     * @param int    $ttl
+     *
+     * @return bool
+     */
+    public function lock(string! key, int ttl = 30) -> bool
+    {
+        return apcu_add(
+            this->getPrefixedKey(this->getLockKey(key)),
+            1,
+            ttl
+        );
+    }
+
     /**
      * Stores data in the adapter
      *
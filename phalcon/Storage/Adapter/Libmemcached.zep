@@ -210,6 +210,20 @@ class Libmemcached extends AbstractAdapter
         return this->getAdapter()->increment(key, value);
     }
 
+    /**
+     * Acquires a lock for a key using the atomic `Memcached::add()`
+     *
+     * @param string $key
+     * @param int    $ttl
+     *
+     * @return bool
+     * @throws Exception
+     */
+    public function lock(string! key, int ttl = 30) -> bool
+    {
+        return this->getAdapter()->add(this->getLockKey(key), 1, ttl);
+    }
+
     /**
      * Stores data in the adapter
      *
@@ -206,6 +206,27 @@ class Redis extends AbstractAdapter
         return this->getAdapter()->incrBy(key, value);
     }
 
+    /**
+     * Acquires a lock for a key using `SET NX`
+     *
+     * @param string $key
+     * @param int    $ttl
+     *
+     * @return bool
+     * @throws Exception
+     */
+    public function lock(string! key, int ttl = 30) -> bool
+    {
+        return (bool) this->getAdapter()->set(
+            this->getLockKey(key),
+            1,
+            [
+                0    : "nx",
+                "ex" : ttl
+            ]
+        );
+    }
+
     /**
      * Stores data in the adapter
      *
@@ -19,6 +19,7 @@ use Phalcon\Storage\SerializerFactory;
 use Phalcon\Storage\Serializer\SerializerInterface;
 use RecursiveDirectoryIterator;
 use RecursiveIteratorIterator;
+use Throwable;
 
 /**
  * Stream adapter
@@ -30,6 +31,13 @@ class Stream extends AbstractAdapter
     */
     protected storageDir = "";
 
+    /**
+     * File handles of the locks held by this instance
+     *
+     * @var array
+     */
+    protected locks = [];
+
     /**
      * @var array
      */
@@ -251,6 +259,46 @@ class Stream extends AbstractAdapter
         return this->set(key, data);
     }
 
+    /**
+     * Acquires a lock for a key using `flock()`. The lock is released with
+     * unlock() or, at the latest, when the process ends.
+     *
+     * @param string $key
+     * @param int    $ttl
+     *
+     * @return bool
+     */
+    public function lock(string! key, int ttl = 30) -> bool
+    {
+        var directory, pointer;
+
+        if isset this->locks[key] {
+            return false;
+        }
+
+        let directory = Str::dirSeparator(this->storageDir . this->prefix . "-lock");
+
+        if !is_dir(directory) {
+            mkdir(directory, 0777, true);
+        }
+
+        let pointer = fopen(directory . md5(key), "c");
+
+        if unlikely false === pointer {
+            return false;
+        }
+
+        if !flock(pointer, LOCK_EX | LOCK_NB) {
+            fclose(pointer);
+
+            return false;
+        }
+
+        let this->locks[key] = pointer;
+
+        return true;
+    }
+
     /**
      * Stores data in the adapter
      *
@@ -281,6 +329,28 @@ class Stream extends AbstractAdapter
         return false !== file_put_contents(directory . key, payload, LOCK_EX);
     }
 
+    /**
+     * Releases a lock acquired with lock()
+     *
+     * @param string $key
+     *
+     * @return bool
+     */
+    public function unlock(string! key) -> bool
+    {
+        var pointer;
+
+        if !fetch pointer, this->locks[key] {
+            return false;
+        }
+
+        unset this->locks[key];
+
+        flock(pointer, LOCK_UN);
+
+        return fclose(pointer);
+    }
+
     /**
      * Returns the folder based on the storageDir and the prefix
      *
@@ -328,7 +398,7 @@ class Stream extends AbstractAdapter
      */
     private function getPayload(string filepath) -> array
     {
-        var payload, pointer;
+        var e, level, payload, pointer;
 
         let pointer = fopen(filepath, 'r');
 
@@ -342,19 +412,23 @@ class Stream extends AbstractAdapter
             return [];
         }
 
-        globals_set("warning.enable", false);
-        set_error_handler(
-            function (number, message, file, line, context) {
-                globals_set("warning.enable", true);
-            },
-            E_NOTICE
-        );
+        /**
+         * Corrupted files do not decode to an array. The notice they raise
+         * is masked like the @ operator does
+         */
+        let level = error_reporting(error_reporting() & ~E_NOTICE);
+
+        try {
+            let payload = unserialize(payload);
+        } catch Throwable, e {
+            error_reporting(level);
 
-        let payload = unserialize(payload);
+            throw e;
+        }
 
-        restore_error_handler();
+        error_reporting(level);
 
-        if unlikely (globals_get("warning.enable") || typeof payload !== "array") {
+        if unlikely typeof payload !== "array" {
             return [];
         }
 
@@ -35,6 +35,61 @@ abstract class AbstractSerializer implements SerializerInterface
         return !(empty data || typeof data === "bool" || is_numeric(data));
 	}
 
+    /**
+     * Unserializes a payload and returns the value. The data of the
+     * serializer is not changed.
+     *
+     * Serializers override this with a stateless implementation; this one
+     * goes through unserialize()/getData() for custom serializers.
+     *
+     * @param mixed $payload
+     *
+     * @return mixed
+     */
+    public function decode(var payload) -> var
+    {
+        var data, value;
+
+        let data = this->data;
+
+        this->unserialize(payload);
+
+        let value      = this->data,
+            this->data = data;
+
+        return value;
+    }
+
+    /**
+     * Serializes a value and returns the payload. The data of the serializer
+     * is not changed.
+     *
+     * @param mixed $value
+     *
+     * @return mixed
+     */
+    public function encode(var value) -> var
+    {
+        var data, payload;
+
+        let data       = this->data,
+            this->data = value,
+            payload    = this->serialize(),
+            this->data = data;
+
+        return payload;
+    }
+
+    /**
+     * Masks the errors of a decode like the @ operator does, returning the
+     * reporting level to restore. Invalid payloads are told apart by the
+     * decoded value, not by the errors, so no handler is installed
+     */
+    protected function maskErrors(int level) -> int
+    {
+        return error_reporting(error_reporting() & ~level);
+    }
+
     /**
      * @return mixed
      */
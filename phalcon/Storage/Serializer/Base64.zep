@@ -14,31 +14,47 @@ use InvalidArgumentException;
 
 class Base64 extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string
-	{
-	    if typeof this->data !== "string" {
-	        throw new InvalidArgumentException(
-	        	"Data for the serializer must of type string"
-	        );
-	    }
-
-		return base64_encode(this->data);
-	}
-
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-	    if typeof data !== "string" {
-	        throw new InvalidArgumentException(
-	        	"Data for the unserializer must of type string"
-	        );
-	    }
-
-		let this->data = base64_decode(data);
-	}
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        if typeof payload !== "string" {
+            throw new InvalidArgumentException(
+                "Data for the unserializer must of type string"
+            );
+        }
+
+        return base64_decode(payload);
+    }
+
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        if typeof value !== "string" {
+            throw new InvalidArgumentException(
+                "Data for the serializer must of type string"
+            );
+        }
+
+        return base64_encode(value);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->encode(this->data);
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
+    }
 }
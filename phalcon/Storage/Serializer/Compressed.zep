@@ -0,0 +1,261 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Storage\Serializer;
+
+use Phalcon\Storage\Exception;
+
+/**
+ * Decorates another serializer and compresses its output when it is larger
+ * than a threshold. Every serialized string is prefixed with one header byte
+ * marking the codec used, so that compressed and uncompressed payloads can be
+ * told apart when unserializing. Payloads without a known header (written by
+ * the decorated serializer alone) are passed to it untouched.
+ *
+ * The codec is zlib unless another one is chosen. Every host reading the
+ * entries needs the extension of the codec; payloads written with a codec
+ * that is not available are treated as a miss.
+ *
+ * ```php
+ * use Phalcon\Storage\Serializer\Compressed;
+ * use Phalcon\Storage\Serializer\Igbinary;
+ *
+ * $serializer = new Compressed(
+ *     null,
+ *     new Igbinary(),
+ *     2048,
+ *     -1,
+ *     Compressed::CODEC_ZSTD
+ * );
+ * ```
+ */
+class Compressed extends AbstractSerializer
+{
+    /**
+     * Header bytes. They cannot start the output of the bundled serializers
+     * for anything that actually gets serialized
+     */
+    const CODEC_NONE = 1;
+    const CODEC_ZLIB = 2;
+    const CODEC_LZ4  = 3;
+    const CODEC_ZSTD = 4;
+
+    /**
+     * @var int
+     */
+    protected codec = 2;
+
+    /**
+     * @var int
+     */
+    protected level = -1;
+
+    /**
+     * @var SerializerInterface
+     */
+    protected serializer { get };
+
+    /**
+     * Payloads smaller than this (in bytes) are not compressed
+     *
+     * @var int
+     */
+    protected threshold = 1024;
+
+    /**
+     * Constructor
+     *
+     * @param mixed               $data
+     * @param SerializerInterface $serializer Defaults to Php
+     * @param int                 $threshold  Minimum size to compress
+     * @param int                 $level      Compression level, -1 for the codec default
+     * @param int                 $codec      One of the CODEC_* constants
+     */
+    public function __construct(
+        var data = null,
+        <SerializerInterface> serializer = null,
+        int threshold = 1024,
+        int level = -1,
+        int codec = self::CODEC_ZLIB
+    ) {
+        if serializer === null {
+            let serializer = new Php();
+        }
+
+        let this->serializer = serializer,
+            this->threshold  = threshold,
+            this->level      = level,
+            this->codec      = codec;
+
+        if unlikely codec == self::CODEC_NONE || !this->isAvailable(codec) {
+            throw new Exception(
+                "The codec " . codec . " is not supported or its extension is not loaded"
+            );
+        }
+
+        parent::__construct(data);
+    }
+
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        var header;
+
+        if typeof payload !== "string" || payload === "" {
+            return this->decodeWith(payload);
+        }
+
+        let header = ord(payload);
+
+        /**
+         * Written by a host with a codec this one does not have
+         */
+        if header > self::CODEC_NONE && header <= self::CODEC_ZSTD && !this->isAvailable(header) {
+            return null;
+        }
+
+        switch header {
+            case self::CODEC_NONE:
+                let payload = substr(payload, 1);
+                break;
+
+            case self::CODEC_ZLIB:
+                let payload = gzuncompress(substr(payload, 1));
+                break;
+
+            case self::CODEC_LZ4:
+                let payload = lz4_uncompress(substr(payload, 1));
+                break;
+
+            case self::CODEC_ZSTD:
+                let payload = zstd_uncompress(substr(payload, 1));
+                break;
+        }
+
+        if unlikely payload === false {
+            return null;
+        }
+
+        return this->decodeWith(payload);
+    }
+
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        var payload;
+
+        let payload = this->encodeWith(value);
+
+        /**
+         * Values the decorated serializer returns as is (numbers, booleans,
+         * empty) stay as they are
+         */
+        if typeof payload !== "string" || !this->isSerializable(value) {
+            return payload;
+        }
+
+        if strlen(payload) < this->threshold {
+            return chr(self::CODEC_NONE) . payload;
+        }
+
+        return chr(this->codec) . this->compress(payload);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->encode(this->data);
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
+    }
+
+    /**
+     * Compresses the payload with the selected codec
+     */
+    private function compress(string! payload) -> string
+    {
+        switch this->codec {
+            case self::CODEC_ZSTD:
+                if this->level > 0 {
+                    return zstd_compress(payload, this->level);
+                }
+
+                return zstd_compress(payload);
+
+            case self::CODEC_LZ4:
+                return lz4_compress(payload);
+
+            default:
+                return gzcompress(payload, this->level);
+        }
+    }
+
+    /**
+     * Unserializes with the decorated serializer
+     */
+    private function decodeWith(var payload) -> var
+    {
+        if this->serializer instanceof AbstractSerializer {
+            return this->serializer->decode(payload);
+        }
+
+        this->serializer->unserialize(payload);
+
+        return this->serializer->getData();
+    }
+
+    /**
+     * Serializes with the decorated serializer
+     */
+    private function encodeWith(var value) -> var
+    {
+        if this->serializer instanceof AbstractSerializer {
+            return this->serializer->encode(value);
+        }
+
+        this->serializer->setData(value);
+
+        return this->serializer->serialize();
+    }
+
+    /**
+     * Checks if the extension of a codec is loaded
+     */
+    private function isAvailable(int codec) -> bool
+    {
+        switch codec {
+            case self::CODEC_NONE:
+                return true;
+
+            case self::CODEC_ZLIB:
+                return function_exists("gzcompress");
+
+            case self::CODEC_LZ4:
+                return function_exists("lz4_compress");
+
+            case self::CODEC_ZSTD:
+                return function_exists("zstd_compress");
+        }
+
+        return false;
+    }
+}
@@ -10,39 +10,60 @@
 
 namespace Phalcon\Storage\Serializer;
 
+use Throwable;
+
 class Igbinary extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string
-	{
-        if !this->isSerializable(this->data) {
-            return this->data;
-        }
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        var e, level, value;
 
-		return igbinary_serialize(this->data);
-	}
+        let level = this->maskErrors(E_WARNING);
 
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-	    globals_set("warning.enable", false);
-        set_error_handler(
-            function (number, message, file, line, context) {
-        	    globals_set("warning.enable", true);
-            },
-            E_WARNING
-        );
+        try {
+            let value = igbinary_unserialize(payload);
+        } catch Throwable, e {
+            error_reporting(level);
 
-		let this->data = igbinary_unserialize(data);
+            throw e;
+        }
 
-        restore_error_handler();
+        error_reporting(level);
+
+        /**
+         * Invalid payloads are already decoded to null
+         */
+        return value;
+    }
 
-        if unlikely globals_get("warning.enable") {
-            let this->data = null;
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        if !this->isSerializable(value) {
+            return value;
         }
+
+        return igbinary_serialize(value);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->encode(this->data);
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
     }
 }
@@ -16,30 +16,46 @@ use Phalcon\Helper\Json as JsonHelper;
 
 class Json extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string
-	{
-	    if typeof this->data == "object" && !(this->data instanceof JsonSerializable) {
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        return JsonHelper::decode(payload);
+    }
+
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        if typeof value == "object" && !(value instanceof JsonSerializable) {
             throw new InvalidArgumentException(
                 "Data for the JSON serializer cannot be of type 'object' " .
                 "without implementing 'JsonSerializable'"
             );
         }
 
-        if !this->isSerializable(this->data) {
-            return this->data;
+        if !this->isSerializable(value) {
+            return value;
         }
 
-		return JsonHelper::encode(this->data);
-	}
+        return JsonHelper::encode(value);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->encode(this->data);
+    }
 
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-		let this->data = JsonHelper::decode(data);
-	}
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
+    }
 }
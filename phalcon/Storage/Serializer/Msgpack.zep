@@ -10,39 +10,64 @@
 
 namespace Phalcon\Storage\Serializer;
 
+use Throwable;
+
 class Msgpack extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string|null
-	{
-        if !this->isSerializable(this->data) {
-            return this->data;
-        }
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        var e, level, value;
 
-		return msgpack_pack(this->data);
-	}
+        let level = this->maskErrors(E_WARNING);
 
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-	    globals_set("warning.enable", false);
-        set_error_handler(
-            function (number, message, file, line, context) {
-        	    globals_set("warning.enable", true);
-            },
-            E_WARNING
-        );
+        try {
+            let value = msgpack_unpack(payload);
+        } catch Throwable, e {
+            error_reporting(level);
 
-        let this->data = msgpack_unpack(data);
+            throw e;
+        }
 
-        restore_error_handler();
+        error_reporting(level);
 
-        if unlikely globals_get("warning.enable") {
-            let this->data = null;
+        /**
+         * Invalid payloads return false, like a packed false does
+         */
+        if unlikely value === false && payload !== msgpack_pack(false) {
+            return null;
         }
-	}
+
+        return value;
+    }
+
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        if !this->isSerializable(value) {
+            return value;
+        }
+
+        return msgpack_pack(value);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string|null
+    {
+        return this->encode(this->data);
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
+    }
 }
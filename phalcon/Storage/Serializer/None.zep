@@ -14,19 +14,35 @@ use InvalidArgumentException;
 
 class None extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string
-	{
-		return this->data;
-	}
+    /**
+     * Returns the payload as is
+     */
+    public function decode(var payload) -> var
+    {
+        return payload;
+    }
 
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-		let this->data = data;
-	}
+    /**
+     * Returns the value as is
+     */
+    public function encode(var value) -> var
+    {
+        return value;
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->data;
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = data;
+    }
 }
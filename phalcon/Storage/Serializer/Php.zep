@@ -12,52 +12,74 @@ namespace Phalcon\Storage\Serializer;
 
 use InvalidArgumentException;
 use Phalcon\Storage\Exception;
+use Throwable;
 
 class Php extends AbstractSerializer
 {
-	/**
-	 * Serializes data
-	 */
-	public function serialize() -> string
-	{
-        if !this->isSerializable(this->data) {
-            return this->data;
+    /**
+     * Unserializes a payload and returns the value
+     */
+    public function decode(var payload) -> var
+    {
+        var e, level, value;
+
+        if !this->isSerializable(payload) {
+            return payload;
         }
 
-		return serialize(this->data);
-	}
-
-	/**
-	 * Unserializes data
-	 */
-	public function unserialize(var data) -> void
-	{
-
-	    if !this->isSerializable(data) {
-	        let this->data = data;
-	    } else {
-
-            if typeof data !== "string" {
-                throw new InvalidArgumentException(
-                    "Data for the unserializer must of type string"
-                );
-            }
-
-            globals_set("warning.enable", false);
-            set_error_handler(
-                function (number, message, file, line, context) {
-                    globals_set("warning.enable", true);
-                },
-                E_NOTICE
+        if typeof payload !== "string" {
+            throw new InvalidArgumentException(
+                "Data for the unserializer must of type string"
             );
+        }
+
+        let level = this->maskErrors(E_NOTICE);
 
-            let this->data = unserialize(data);
+        try {
+            let value = unserialize(payload);
+        } catch Throwable, e {
+            error_reporting(level);
 
-            restore_error_handler();
+            throw e;
+        }
+
+        error_reporting(level);
 
-            if unlikely globals_get("warning.enable") {
-                let this->data = null;
-            }
+        /**
+         * Invalid payloads return false, like a serialized false does
+         */
+        if unlikely value === false && payload !== "b:0;" {
+            return null;
         }
-	}
+
+        return value;
+    }
+
+    /**
+     * Serializes a value and returns the payload
+     */
+    public function encode(var value) -> var
+    {
+        if !this->isSerializable(value) {
+            return value;
+        }
+
+        return serialize(value);
+    }
+
+    /**
+     * Serializes data
+     */
+    public function serialize() -> string
+    {
+        return this->encode(this->data);
+    }
+
+    /**
+     * Unserializes data
+     */
+    public function unserialize(var data) -> void
+    {
+        let this->data = this->decode(data);
+    }
 }
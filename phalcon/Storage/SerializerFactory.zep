@@ -45,12 +45,13 @@ class SerializerFactory extends AbstractFactory
     protected function getAdapters() -> array
     {
         return [
-            "base64"   : "Phalcon\\Storage\\Serializer\\Base64",
-            "igbinary" : "Phalcon\\Storage\\Serializer\\Igbinary",
-            "json"     : "Phalcon\\Storage\\Serializer\\Json",
-            "msgpack"  : "Phalcon\\Storage\\Serializer\\Msgpack",
-            "none"     : "Phalcon\\Storage\\Serializer\\None",
-            "php"      : "Phalcon\\Storage\\Serializer\\Php"
+            "base64"     : "Phalcon\\Storage\\Serializer\\Base64",
+            "compressed" : "Phalcon\\Storage\\Serializer\\Compressed",
+            "igbinary"   : "Phalcon\\Storage\\Serializer\\Igbinary",
+            "json"       : "Phalcon\\Storage\\Serializer\\Json",
+            "msgpack"    : "Phalcon\\Storage\\Serializer\\Msgpack",
+            "none"       : "Phalcon\\Storage\\Serializer\\None",
+            "php"        : "Phalcon\\Storage\\Serializer\\Php"
         ];
     }
 }
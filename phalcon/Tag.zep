@@ -864,7 +864,8 @@ class Tag
      */
     public static function renderAttributes(string! code, array! attributes) -> string
     {
-        var order, escaper, attrs, attribute, value, escaped, key, newCode;
+        var order, escaper, attrs, attribute, value, escaped, key, newCode,
+            rendered;
 
         let order = [
             "rel"    : null,
@@ -897,6 +898,17 @@ class Tag
 
         unset attrs["escape"];
 
+        /**
+         * The stock escaper renders all the attributes natively
+         */
+        if typeof escaper == "object" && get_class(escaper) === "Phalcon\\Escaper" {
+            let rendered = escaper->{"attributes"}(attrs);
+
+            if rendered !== false {
+                return code . rendered;
+            }
+        }
+
         let newCode = code;
 
         for key, value in attrs {
@@ -929,12 +941,10 @@ class Tag
     }
 
     /**
-     * Resets the request and internal values to avoid those fields will have
-     * any default value.
-     *
-     * @deprecated Will be removed in 4.0.0
+     * Resets the values of the form elements and the document title set while
+     * handling the current request
      */
-    deprecated public static function resetInput() -> void
+    public static function reset() -> void
     {
         let self::displayValues = [],
             self::documentTitle = null,
@@ -943,6 +953,17 @@ class Tag
             self::documentTitleSeparator = null;
     }
 
+    /**
+     * Resets the request and internal values to avoid those fields will have
+     * any default value.
+     *
+     * @deprecated Will be removed in 4.0.0
+     */
+    deprecated public static function resetInput() -> void
+    {
+        self::reset();
+    }
+
     /**
      * Builds a HTML input[type="search"] tag
      *
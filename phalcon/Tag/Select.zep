@@ -152,38 +152,10 @@ abstract class Select
      */
     private static function optionsFromArray(array data, var value, string closeOption) -> string
     {
-        var strValue, strOptionValue, code, optionValue, optionText, escaped;
-
-        let code = "";
-
-        for optionValue, optionText in data {
-            let escaped = htmlspecialchars(optionValue);
-
-            if typeof optionText == "array" {
-                let code .= "\t<optgroup label=\"" . escaped . "\">" . PHP_EOL . self::optionsFromArray(optionText, value, closeOption) . "\t</optgroup>" . PHP_EOL;
-
-                continue;
-            }
-
-            if typeof value == "array" {
-                if in_array(optionValue, value) {
-                    let code .= "\t<option selected=\"selected\" value=\"" . escaped . "\">" . optionText . closeOption;
-                } else {
-                    let code .= "\t<option value=\"" . escaped . "\">" . optionText . closeOption;
-                }
-            } else {
-                let strOptionValue = (string) optionValue,
-                    strValue = (string) value;
-
-                if strOptionValue === strValue {
-                    let code .= "\t<option selected=\"selected\" value=\"" . escaped . "\">" . optionText . closeOption;
-                } else {
-                    let code .= "\t<option value=\"" . escaped . "\">" . optionText . closeOption;
-                }
-            }
-        }
-
-        return code;
+        /**
+         * All the options (and groups) are rendered natively in one buffer
+         */
+        return phalcon_html_render_options(data, value, closeOption);
     }
 
     /**
@@ -15,10 +15,13 @@ use Phalcon\Di\Injectable;
 use Phalcon\Filter\FilterInterface;
 use Phalcon\Messages\MessageInterface;
 use Phalcon\Messages\Messages;
+use Phalcon\Validation\BatchValidatorInterface;
 use Phalcon\Validation\ValidationInterface;
 use Phalcon\Validation\Exception;
 use Phalcon\Validation\ValidatorInterface;
 use Phalcon\Validation\AbstractCombinedFieldsValidator;
+use Throwable;
+use Traversable;
 
 /**
  * Allows to validate data using custom or built-in validators
@@ -491,6 +494,112 @@ class Validation extends Injectable implements ValidationInterface
         return this->messages;
     }
 
+    /**
+     * Validates many data sets with the same rules, returning the messages
+     * (or false if `beforeValidation` cancels it) of each row under its key.
+     * Validators implementing BatchValidatorInterface receive the values of
+     * all the rows first, e.g. Uniqueness checks them with a single query
+     *
+     *```php
+     * $results = $validation->validateMany($rows);
+     *
+     * foreach ($results as $line => $messages) {
+     *     if (count($messages)) {
+     *         // ...
+     *     }
+     * }
+     *```
+     *
+     * @param array|Traversable rows
+     */
+    public function validateMany(var rows) -> array
+    {
+        var batchValidators, e, field, fields, key, results, row, scope,
+            singleField, validator, validators, values;
+
+        if typeof rows == "object" && rows instanceof Traversable {
+            let rows = iterator_to_array(rows);
+        }
+
+        if unlikely typeof rows != "array" {
+            throw new Exception(
+                "Rows to validate must be an array or a Traversable object"
+            );
+        }
+
+        let batchValidators = [];
+
+        if typeof this->validators == "array" {
+            for field, validators in this->validators {
+                for validator in validators {
+                    if validator instanceof BatchValidatorInterface {
+                        let batchValidators[] = [field, validator];
+                    }
+                }
+            }
+        }
+
+        if typeof this->combinedFieldsValidators == "array" {
+            for scope in this->combinedFieldsValidators {
+                if typeof scope == "array" && scope[1] instanceof BatchValidatorInterface {
+                    let batchValidators[] = scope;
+                }
+            }
+        }
+
+        /**
+         * Collect the values of the batch validators once per row
+         */
+        for scope in batchValidators {
+            let field  = scope[0],
+                fields = (typeof field == "array") ? field : [field],
+                values = [];
+
+            for key, row in rows {
+                if unlikely (typeof row != "array" && typeof row != "object") {
+                    throw new Exception("Invalid data to validate");
+                }
+
+                let this->data   = row,
+                    this->values = null;
+
+                let values[key] = [];
+
+                for singleField in fields {
+                    let values[key][singleField] = this->getValue(singleField);
+                }
+            }
+
+            let validator = scope[1];
+
+            validator->beginBatch(this, field, values);
+        }
+
+        let results = [];
+
+        try {
+            for key, row in rows {
+                let results[key] = this->validate(row);
+            }
+        } catch Throwable, e {
+            for scope in batchValidators {
+                let validator = scope[1];
+
+                validator->endBatch();
+            }
+
+            throw e;
+        }
+
+        for scope in batchValidators {
+            let validator = scope[1];
+
+            validator->endBatch();
+        }
+
+        return results;
+    }
+
     /**
      * Internal validations, if it returns true, then skip the current validator
      */
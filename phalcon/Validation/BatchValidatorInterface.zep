@@ -0,0 +1,31 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Validation;
+
+use Phalcon\Validation;
+
+/**
+ * Interface for validators that can prepare the validation of many rows at
+ * once when Phalcon\Validation::validateMany() is used
+ */
+interface BatchValidatorInterface
+{
+    /**
+     * Called before the rows are validated one by one. The values are the
+     * ones of the field(s) of the validator, indexed by the key of each row
+     */
+    public function beginBatch(<Validation> validation, var field, array values) -> void;
+
+    /**
+     * Releases the state built by beginBatch()
+     */
+    public function endBatch() -> void;
+}
@@ -15,6 +15,7 @@ use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Validation;
 use Phalcon\Validation\AbstractCombinedFieldsValidator;
+use Phalcon\Validation\BatchValidatorInterface;
 use Phalcon\Validation\Exception;
 //use Phalcon\Mvc\CollectionInterface;
 //use Phalcon\Mvc\Collection;
@@ -88,11 +89,29 @@ use Phalcon\Validation\Exception;
  *     )
  * );
  * ```
+ *
+ * With `Phalcon\Validation::validateMany()` the values of all the rows are
+ * checked with one `IN` query per 1000 values, and repeated values within the
+ * rows are reported as not unique
  */
-class Uniqueness extends AbstractCombinedFieldsValidator
+class Uniqueness extends AbstractCombinedFieldsValidator implements BatchValidatorInterface
 {
     protected template = "Field :field must be unique";
 
+    /**
+     * Values seen in the rows validated so far, per field
+     *
+     * @var array
+     */
+    private batchSeen = [];
+
+    /**
+     * Values already stored in the database, per field
+     *
+     * @var array
+     */
+    private batchTaken = [];
+
     private columnMap = null;
 
     /**
@@ -112,6 +131,110 @@ class Uniqueness extends AbstractCombinedFieldsValidator
         parent::__construct(options);
     }
 
+    /**
+     * Looks up the values of a single field in all the rows with one query.
+     * The `except` option, combinations of fields and persistent records keep
+     * using a query per row
+     */
+    public function beginBatch(<Validation> validation, var field, array values) -> void
+    {
+        var attribute, candidates, className, convert, existing, item,
+            placeholders, record, rowValues, singleField, chunk, taken, value;
+        int index;
+
+        if typeof field == "array" {
+            if count(field) != 1 {
+                return;
+            }
+
+            let singleField = field[0];
+        } else {
+            let singleField = field;
+        }
+
+        if this->getOption("except") {
+            return;
+        }
+
+        let record = this->getOption("model");
+
+        if empty record || typeof record != "object" {
+            let record = validation->getEntity();
+        }
+
+        if !(record instanceof ModelInterface) || record->getDirtyState() == Model::DIRTY_STATE_PERSISTENT {
+            return;
+        }
+
+        let candidates = [],
+            convert    = this->getOption("convert");
+
+        for rowValues in values {
+            if convert != null {
+                let rowValues = {convert}(rowValues);
+
+                if unlikely !is_array(rowValues) {
+                    throw new Exception("Value conversion must return an array");
+                }
+            }
+
+            if fetch value, rowValues[singleField] {
+                if is_string(value) || is_int(value) {
+                    let candidates[(string) value] = value;
+                }
+            }
+        }
+
+        let attribute = this->getColumnNameReal(
+                record,
+                this->getOption("attribute", singleField)
+            ),
+            className = get_class(record),
+            taken     = [];
+
+        for chunk in array_chunk(array_values(candidates), 1000) {
+            let placeholders = [];
+
+            for index, value in chunk {
+                let placeholders[] = "?" . index;
+            }
+
+            let existing = {className}::find(
+                [
+                    "columns":    attribute,
+                    "conditions": attribute . " IN (" . join(",", placeholders) . ")",
+                    "bind":       chunk
+                ]
+            );
+
+            for item in existing {
+                let value = (string) item->readAttribute(attribute);
+
+                /**
+                 * The database matched a different value (e.g. a case
+                 * insensitive collation), so the rows are checked one by one
+                 */
+                if unlikely !isset candidates[value] {
+                    return;
+                }
+
+                let taken[value] = true;
+            }
+        }
+
+        let this->batchTaken[singleField] = taken,
+            this->batchSeen[singleField]  = [];
+    }
+
+    /**
+     * Releases the values looked up by beginBatch()
+     */
+    public function endBatch() -> void
+    {
+        let this->batchSeen  = [],
+            this->batchTaken = [];
+    }
+
     /**
      * Executes the validation
      */
@@ -149,7 +272,8 @@ class Uniqueness extends AbstractCombinedFieldsValidator
 
     protected function isUniqueness(<Validation> validation, var field) -> bool
     {
-        var values, convert, record, params, className, isModel, singleField;
+        var values, convert, record, params, className, isModel, singleField,
+            seen, taken, value;
 //
 // @todo: Restore when new Collection is reintroduced
 //
@@ -177,6 +301,32 @@ class Uniqueness extends AbstractCombinedFieldsValidator
             }
         }
 
+        /**
+         * Values looked up by beginBatch() don't need a query
+         */
+        if count(field) == 1 {
+            let singleField = field[0];
+
+            if fetch taken, this->batchTaken[singleField] {
+                let value = null,
+                    seen  = this->batchSeen[singleField];
+
+                fetch value, values[singleField];
+
+                if is_string(value) || is_int(value) {
+                    let value = (string) value;
+
+                    if isset taken[value] || isset seen[value] {
+                        return false;
+                    }
+
+                    let this->batchSeen[singleField][value] = true;
+
+                    return true;
+                }
+            }
+        }
+
         let record = this->getOption("model");
 
         if empty record || typeof record != "object" {
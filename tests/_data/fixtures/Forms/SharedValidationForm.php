@@ -0,0 +1,38 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Fixtures\Forms;
+
+use Phalcon\Forms\Element\Text;
+use Phalcon\Forms\Form;
+use Phalcon\Validation\Validator\PresenceOf;
+
+class SharedValidationForm extends Form
+{
+    protected $shareValidation = true;
+
+    public function initialize($entity = null, $options = null)
+    {
+        $field = new Text('name');
+
+        $field->addValidator(
+            new PresenceOf(
+                [
+                    'message' => 'The name is required',
+                ]
+            )
+        );
+
+        $this->add($field);
+    }
+}
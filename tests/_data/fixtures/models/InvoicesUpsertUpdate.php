@@ -0,0 +1,32 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Models;
+
+/**
+ * Class InvoicesUpsertUpdate
+ *
+ * @property int    $inv_id
+ * @property int    $inv_cst_id
+ * @property int    $inv_status_flag
+ * @property string $inv_title
+ * @property float  $inv_total
+ * @property string $inv_created_at
+ */
+class InvoicesUpsertUpdate extends InvoicesUpsert
+{
+    public function beforeUpdate()
+    {
+        $this->afterEvents[] = 'beforeUpdate';
+    }
+}
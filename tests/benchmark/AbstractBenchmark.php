@@ -0,0 +1,58 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+/**
+ * Base class of the benchmarks. Every public `bench*()` method is a subject,
+ * called `$iterations` times per revolution by the runner.
+ */
+abstract class AbstractBenchmark
+{
+    /**
+     * Calls of a subject per revolution
+     *
+     * @var int
+     */
+    protected $iterations = 10000;
+
+    public function getIterations(): int
+    {
+        return $this->iterations;
+    }
+
+    /**
+     * Returns the subjects that cannot run in this environment, e.g. for a
+     * missing extension
+     *
+     * @return string[]
+     */
+    public function getSkipped(): array
+    {
+        return [];
+    }
+
+    /**
+     * Prepares the fixtures, before the subjects of the class run
+     */
+    public function setUp(): void
+    {
+    }
+
+    /**
+     * Removes the fixtures, after the subjects of the class ran
+     */
+    public function tearDown(): void
+    {
+    }
+}
@@ -0,0 +1,62 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Di;
+use Phalcon\Escaper;
+use Phalcon\Filter;
+
+class DiBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var Di
+     */
+    private $container;
+
+    public function setUp(): void
+    {
+        $this->container = new Di();
+
+        $this->container->setShared('escaper', Escaper::class);
+        $this->container->set('filter', Filter::class);
+        $this->container->setShared(
+            'closure',
+            function () {
+                return new Escaper();
+            }
+        );
+
+        $this->container->get('closure');
+    }
+
+    public function benchGetShared(): void
+    {
+        $this->container->getShared('escaper');
+    }
+
+    public function benchGetSharedClosure(): void
+    {
+        $this->container->get('closure');
+    }
+
+    public function benchGetNew(): void
+    {
+        $this->container->get('filter');
+    }
+
+    public function benchHas(): void
+    {
+        $this->container->has('escaper');
+    }
+}
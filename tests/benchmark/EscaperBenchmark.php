@@ -0,0 +1,71 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Escaper;
+
+class EscaperBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var Escaper
+     */
+    private $escaper;
+
+    /**
+     * @var string
+     */
+    private $clean;
+
+    /**
+     * @var string
+     */
+    private $html;
+
+    public function setUp(): void
+    {
+        $this->escaper = new Escaper();
+        $this->clean   = str_repeat('The quick brown fox jumps over the lazy dog ', 8);
+        $this->html    = str_repeat('<a href="/fox?a=1&b=2">It\'s a "fox" élan</a> ', 8);
+    }
+
+    public function benchEscapeHtmlClean(): void
+    {
+        $this->escaper->escapeHtml($this->clean);
+    }
+
+    public function benchEscapeHtml(): void
+    {
+        $this->escaper->escapeHtml($this->html);
+    }
+
+    public function benchEscapeHtmlAttr(): void
+    {
+        $this->escaper->escapeHtmlAttr($this->html);
+    }
+
+    public function benchEscapeJs(): void
+    {
+        $this->escaper->escapeJs($this->html);
+    }
+
+    public function benchEscapeCss(): void
+    {
+        $this->escaper->escapeCss($this->html);
+    }
+
+    public function benchEscapeUrl(): void
+    {
+        $this->escaper->escapeUrl($this->html);
+    }
+}
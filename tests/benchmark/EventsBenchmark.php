@@ -0,0 +1,49 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Events\Event;
+use Phalcon\Events\Manager;
+
+class EventsBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var Manager
+     */
+    private $manager;
+
+    public function setUp(): void
+    {
+        $this->manager = new Manager();
+
+        for ($counter = 0; $counter < 5; $counter++) {
+            $this->manager->attach(
+                'bench',
+                function (Event $event, $source, $data) {
+                    return true;
+                }
+            );
+        }
+    }
+
+    public function benchFire(): void
+    {
+        $this->manager->fire('bench:run', $this, ['data']);
+    }
+
+    public function benchFireWithoutListeners(): void
+    {
+        $this->manager->fire('missing:run', $this);
+    }
+}
@@ -0,0 +1,118 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Di;
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Test\Models\Invoices;
+
+/**
+ * Reads the invoices of a SQLite database created in the temporary
+ * directory
+ */
+class ModelBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var int
+     */
+    protected $iterations = 200;
+
+    /**
+     * @var string
+     */
+    private $database;
+
+    public function setUp(): void
+    {
+        $this->database = tempnam(sys_get_temp_dir(), 'phalcon-benchmark-');
+
+        $connection = new Sqlite(
+            [
+                'dbname' => $this->database,
+            ]
+        );
+
+        $connection->execute(
+            'CREATE TABLE co_invoices (
+                inv_id          INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
+                inv_cst_id      INTEGER,
+                inv_status_flag INTEGER,
+                inv_title       TEXT,
+                inv_total       REAL,
+                inv_created_at  TEXT
+            )'
+        );
+
+        $connection->begin();
+
+        for ($counter = 1; $counter <= 100; $counter++) {
+            $connection->insertAsDict(
+                'co_invoices',
+                [
+                    'inv_cst_id'      => $counter % 10,
+                    'inv_status_flag' => $counter % 2,
+                    'inv_title'       => 'Invoice ' . $counter,
+                    'inv_total'       => $counter * 10.5,
+                    'inv_created_at'  => '2020-03-20 10:00:00',
+                ]
+            );
+        }
+
+        $connection->commit();
+
+        $container = new FactoryDefault();
+
+        $container->setShared('db', $connection);
+
+        Di::setDefault($container);
+    }
+
+    public function tearDown(): void
+    {
+        Di::reset();
+
+        unlink($this->database);
+    }
+
+    public function benchFindHydrate(): void
+    {
+        foreach (Invoices::find() as $invoice) {
+        }
+    }
+
+    public function benchFindToArray(): void
+    {
+        Invoices::find()->toArray();
+    }
+
+    public function benchFindFirstById(): void
+    {
+        Invoices::findFirst(42);
+    }
+
+    public function benchFindFirstByMagic(): void
+    {
+        Invoices::findFirstByInvTitle('Invoice 42');
+    }
+
+    public function benchCount(): void
+    {
+        Invoices::count(
+            [
+                'inv_status_flag = 1',
+            ]
+        );
+    }
+}
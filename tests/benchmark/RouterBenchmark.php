@@ -0,0 +1,72 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Mvc\Router;
+
+class RouterBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var Router
+     */
+    private $router;
+
+    public function setUp(): void
+    {
+        $this->router = new Router(false);
+
+        /**
+         * A table of the size of a small application, with the matching
+         * routes added last
+         */
+        for ($counter = 0; $counter < 50; $counter++) {
+            $this->router->add(
+                '/module' . $counter . '/:controller/:action/:params',
+                [
+                    'module' => 'module' . $counter,
+                ]
+            );
+        }
+
+        $this->router->add(
+            '/about',
+            [
+                'controller' => 'pages',
+                'action'     => 'about',
+            ]
+        );
+
+        $this->router->add(
+            '/products/{action:[a-z]+}/{id:[0-9]+}',
+            [
+                'controller' => 'products',
+            ]
+        );
+    }
+
+    public function benchHandleStatic(): void
+    {
+        $this->router->handle('/about');
+    }
+
+    public function benchHandleParameters(): void
+    {
+        $this->router->handle('/products/edit/42');
+    }
+
+    public function benchHandleNotFound(): void
+    {
+        $this->router->handle('/missing/route');
+    }
+}
@@ -0,0 +1,270 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Version;
+use ReflectionClass;
+use ReflectionMethod;
+
+/**
+ * Runs the benchmarks with fixed iteration counts and reports the time per
+ * call and the memory of every subject
+ */
+class Runner
+{
+    /**
+     * @var string[]
+     */
+    private $classes;
+
+    /**
+     * @var string|null
+     */
+    private $filter;
+
+    /**
+     * @var int
+     */
+    private $revolutions;
+
+    /**
+     * @var int
+     */
+    private $warmup;
+
+    /**
+     * @param string[]    $classes     Benchmark classes to run
+     * @param string|null $filter      Only run the subjects containing it
+     * @param int         $revolutions Timed runs of every subject
+     * @param int         $warmup      Untimed runs before them
+     */
+    public function __construct(
+        array $classes,
+        string $filter = null,
+        int $revolutions = 5,
+        int $warmup = 1
+    ) {
+        $this->classes     = $classes;
+        $this->filter      = $filter;
+        $this->revolutions = $revolutions;
+        $this->warmup      = $warmup;
+    }
+
+    /**
+     * Runs the subjects, returning a report that can be stored as JSON
+     */
+    public function run(callable $progress = null): array
+    {
+        $results = [];
+
+        foreach ($this->classes as $class) {
+            $subjects = $this->getSubjects($class);
+
+            if (empty($subjects)) {
+                continue;
+            }
+
+            /** @var AbstractBenchmark $benchmark */
+            $benchmark = new $class();
+            $benchmark->setUp();
+
+            $skipped = $benchmark->getSkipped();
+
+            foreach ($subjects as $name => $method) {
+                if (in_array($method, $skipped, true)) {
+                    continue;
+                }
+
+                $result         = $this->measure($benchmark, $method);
+                $results[$name] = $result;
+
+                if (null !== $progress) {
+                    $progress($name, $result);
+                }
+            }
+
+            $benchmark->tearDown();
+        }
+
+        return [
+            'php'         => PHP_VERSION,
+            'phalcon'     => Version::get(),
+            'date'        => date('c'),
+            'revolutions' => $this->revolutions,
+            'results'     => $results,
+        ];
+    }
+
+    /**
+     * Formats a report, with the change of the median against a previous one
+     */
+    public static function format(array $report, array $baseline = null): string
+    {
+        $output = sprintf(
+            "Phalcon %s, PHP %s, %d revolutions\n\n",
+            $report['phalcon'],
+            $report['php'],
+            $report['revolutions']
+        );
+
+        $output .= str_pad('Subject', 44)
+            . str_pad('Iterations', 12, ' ', STR_PAD_LEFT)
+            . str_pad('Median', 14, ' ', STR_PAD_LEFT)
+            . str_pad('Min', 14, ' ', STR_PAD_LEFT)
+            . str_pad('Memory', 12, ' ', STR_PAD_LEFT)
+            . (null !== $baseline ? str_pad('Change', 10, ' ', STR_PAD_LEFT) : '')
+            . "\n";
+
+        foreach ($report['results'] as $name => $result) {
+            $output .= str_pad($name, 44)
+                . str_pad((string) $result['iterations'], 12, ' ', STR_PAD_LEFT)
+                . str_pad(self::formatTime($result['median']), 14, ' ', STR_PAD_LEFT)
+                . str_pad(self::formatTime($result['min']), 14, ' ', STR_PAD_LEFT)
+                . str_pad(self::formatBytes($result['memory']), 12, ' ', STR_PAD_LEFT);
+
+            if (null !== $baseline) {
+                $change = '-';
+
+                if (isset($baseline['results'][$name]['median']) && $baseline['results'][$name]['median'] > 0) {
+                    $change = sprintf(
+                        '%+.1f%%',
+                        ($result['median'] / $baseline['results'][$name]['median'] - 1) * 100
+                    );
+                }
+
+                $output .= str_pad($change, 10, ' ', STR_PAD_LEFT);
+            }
+
+            $output .= "\n";
+        }
+
+        return $output;
+    }
+
+    private static function formatBytes(int $bytes): string
+    {
+        if ($bytes >= 1048576 || $bytes <= -1048576) {
+            return sprintf('%.1fMB', $bytes / 1048576);
+        }
+
+        if ($bytes >= 1024 || $bytes <= -1024) {
+            return sprintf('%.1fKB', $bytes / 1024);
+        }
+
+        return $bytes . 'B';
+    }
+
+    /**
+     * Formats nanoseconds per call
+     */
+    private static function formatTime(float $time): string
+    {
+        if ($time >= 1000000) {
+            return sprintf('%.2fms', $time / 1000000);
+        }
+
+        if ($time >= 1000) {
+            return sprintf('%.2fus', $time / 1000);
+        }
+
+        return sprintf('%.0fns', $time);
+    }
+
+    /**
+     * Returns a monotonic time in nanoseconds
+     */
+    private static function now(): float
+    {
+        if (function_exists('hrtime')) {
+            return (float) hrtime(true);
+        }
+
+        return microtime(true) * 1000000000;
+    }
+
+    /**
+     * Returns the bench*() methods of a class, keyed by their report name
+     */
+    private function getSubjects(string $class): array
+    {
+        $reflection = new ReflectionClass($class);
+        $prefix     = substr($reflection->getShortName(), 0, -strlen('Benchmark'));
+        $subjects   = [];
+
+        foreach ($reflection->getMethods(ReflectionMethod::IS_PUBLIC) as $method) {
+            if (0 !== stripos($method->getName(), 'bench')) {
+                continue;
+            }
+
+            $name = $prefix . '::' . lcfirst(substr($method->getName(), 5));
+
+            if (null !== $this->filter && false === stripos($name, $this->filter)) {
+                continue;
+            }
+
+            $subjects[$name] = $method->getName();
+        }
+
+        return $subjects;
+    }
+
+    /**
+     * Times the revolutions of a subject. The times are in nanoseconds per
+     * call and the memory is the one still used after the first revolution
+     */
+    private function measure(AbstractBenchmark $benchmark, string $method): array
+    {
+        $iterations = $benchmark->getIterations();
+        $times      = [];
+
+        for ($revolution = 0; $revolution < $this->warmup; $revolution++) {
+            for ($iteration = 0; $iteration < $iterations; $iteration++) {
+                $benchmark->$method();
+            }
+        }
+
+        gc_collect_cycles();
+
+        $memory = memory_get_usage();
+
+        for ($revolution = 0; $revolution < $this->revolutions; $revolution++) {
+            mt_srand(1);
+
+            $start = self::now();
+
+            for ($iteration = 0; $iteration < $iterations; $iteration++) {
+                $benchmark->$method();
+            }
+
+            $times[] = (self::now() - $start) / $iterations;
+
+            if (0 === $revolution) {
+                gc_collect_cycles();
+
+                $memory = memory_get_usage() - $memory;
+            }
+        }
+
+        sort($times);
+
+        return [
+            'iterations' => $iterations,
+            'median'     => $times[(int) (count($times) / 2)],
+            'min'        => $times[0],
+            'mean'       => array_sum($times) / count($times),
+            'memory'     => $memory,
+            'peak'       => memory_get_peak_usage(),
+        ];
+    }
+}
@@ -0,0 +1,168 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\Adapter\Stream;
+use Phalcon\Storage\SerializerFactory;
+
+/**
+ * Serializers and the storage adapters that do not need a service
+ */
+class StorageBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var string
+     */
+    private $directory;
+
+    /**
+     * @var Memory
+     */
+    private $memory;
+
+    /**
+     * @var array
+     */
+    private $payload;
+
+    /**
+     * @var array
+     */
+    private $serializers = [];
+
+    /**
+     * @var Stream
+     */
+    private $stream;
+
+    public function setUp(): void
+    {
+        $factory = new SerializerFactory();
+
+        foreach (['php', 'json', 'igbinary', 'msgpack'] as $name) {
+            if ('php' === $name || 'json' === $name || extension_loaded($name)) {
+                $this->serializers[$name] = $factory->newInstance($name);
+            }
+        }
+
+        $this->payload = [];
+
+        for ($counter = 0; $counter < 50; $counter++) {
+            $this->payload[] = [
+                'id'     => $counter,
+                'name'   => 'Item ' . $counter,
+                'price'  => $counter * 1.5,
+                'active' => 0 === $counter % 2,
+                'tags'   => ['one', 'two', 'three'],
+            ];
+        }
+
+        $this->directory = sys_get_temp_dir() . '/phalcon-benchmark-' . getmypid() . '/';
+
+        $this->memory = new Memory($factory);
+        $this->stream = new Stream(
+            $factory,
+            [
+                'storageDir' => $this->directory,
+            ]
+        );
+
+        $this->memory->set('payload', $this->payload);
+        $this->stream->set('payload', $this->payload);
+    }
+
+    public function getSkipped(): array
+    {
+        $skipped = [];
+
+        foreach (['igbinary', 'msgpack'] as $name) {
+            if (!isset($this->serializers[$name])) {
+                $skipped[] = 'benchSerialize' . ucfirst($name);
+            }
+        }
+
+        return $skipped;
+    }
+
+    public function tearDown(): void
+    {
+        $this->stream->clear();
+
+        if (is_dir($this->directory)) {
+            $files = new \RecursiveIteratorIterator(
+                new \RecursiveDirectoryIterator($this->directory, \FilesystemIterator::SKIP_DOTS),
+                \RecursiveIteratorIterator::CHILD_FIRST
+            );
+
+            foreach ($files as $file) {
+                $file->isDir() ? rmdir($file->getPathname()) : unlink($file->getPathname());
+            }
+
+            rmdir($this->directory);
+        }
+    }
+
+    public function benchSerializePhp(): void
+    {
+        $this->roundTrip('php');
+    }
+
+    public function benchSerializeJson(): void
+    {
+        $this->roundTrip('json');
+    }
+
+    public function benchSerializeIgbinary(): void
+    {
+        $this->roundTrip('igbinary');
+    }
+
+    public function benchSerializeMsgpack(): void
+    {
+        $this->roundTrip('msgpack');
+    }
+
+    public function benchMemoryGet(): void
+    {
+        $this->memory->get('payload');
+    }
+
+    public function benchMemorySet(): void
+    {
+        $this->memory->set('payload', $this->payload);
+    }
+
+    public function benchStreamGet(): void
+    {
+        $this->stream->get('payload');
+    }
+
+    public function benchStreamSet(): void
+    {
+        $this->stream->set('payload', $this->payload);
+    }
+
+    /**
+     * Encodes and decodes the payload
+     */
+    private function roundTrip(string $name): void
+    {
+        $serializer = $this->serializers[$name];
+
+        $serializer->decode(
+            $serializer->encode($this->payload)
+        );
+    }
+}
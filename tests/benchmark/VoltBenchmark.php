@@ -0,0 +1,64 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Benchmark;
+
+use Phalcon\Mvc\View\Engine\Volt\Compiler;
+
+class VoltBenchmark extends AbstractBenchmark
+{
+    /**
+     * @var int
+     */
+    protected $iterations = 1000;
+
+    /**
+     * @var Compiler
+     */
+    private $compiler;
+
+    /**
+     * @var string
+     */
+    private $template = <<<VOLT
+{% extends "layouts/main.volt" %}
+
+{% block content %}
+    <h1>{{ title|e }}</h1>
+
+    {% for product in products %}
+        {% if loop.first %}<ul>{% endif %}
+        <li class="{{ cycle(['odd', 'even']) }}">
+            {{ link_to('products/' ~ product.id, product.name|upper) }}
+            {{ product.price|default(0)|format('%.2f') }}
+        </li>
+        {% if loop.last %}</ul>{% endif %}
+    {% else %}
+        <p>{{ 'No products'|trim }}</p>
+    {% endfor %}
+
+    {% set total = products|length %}
+    {{ partial('partials/pager', ['page': page, 'total': total]) }}
+{% endblock %}
+VOLT;
+
+    public function setUp(): void
+    {
+        $this->compiler = new Compiler();
+    }
+
+    public function benchCompileString(): void
+    {
+        $this->compiler->compileString($this->template, true);
+    }
+}
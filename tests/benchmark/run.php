@@ -0,0 +1,116 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+/**
+ * Runs the benchmarks of the hot paths of the framework:
+ *
+ *     php tests/benchmark/run.php [options]
+ *
+ *     --filter=<text>       Only run the subjects containing the text,
+ *                           e.g. "Router::" or "escapeHtml"
+ *     --revolutions=<n>     Timed runs of every subject (default 5)
+ *     --output=<file>       Stores the report as JSON
+ *     --compare=<file>      Shows the change against a stored report
+ *     --json                Prints the report as JSON
+ */
+
+use Phalcon\Test\Benchmark\Runner;
+
+error_reporting(E_ALL);
+ini_set('display_errors', 'On');
+
+$root = dirname(dirname(__DIR__));
+
+if (!extension_loaded('phalcon')) {
+    fwrite(STDERR, "The phalcon extension is not loaded\n");
+    exit(1);
+}
+
+if (file_exists($root . '/vendor/autoload.php')) {
+    require_once $root . '/vendor/autoload.php';
+}
+
+spl_autoload_register(
+    function (string $className) use ($root) {
+        $namespaces = [
+            'Phalcon\\Test\\Benchmark\\' => $root . '/tests/benchmark/',
+            'Phalcon\\Test\\Models\\'    => $root . '/tests/_data/fixtures/models/',
+        ];
+
+        foreach ($namespaces as $prefix => $directory) {
+            if (0 === strpos($className, $prefix)) {
+                $file = $directory . str_replace('\\', '/', substr($className, strlen($prefix))) . '.php';
+
+                if (file_exists($file)) {
+                    require_once $file;
+                }
+
+                return;
+            }
+        }
+    }
+);
+
+$options = getopt('', ['filter:', 'revolutions:', 'output:', 'compare:', 'json']);
+
+$classes = [
+    Phalcon\Test\Benchmark\DiBenchmark::class,
+    Phalcon\Test\Benchmark\RouterBenchmark::class,
+    Phalcon\Test\Benchmark\EventsBenchmark::class,
+    Phalcon\Test\Benchmark\EscaperBenchmark::class,
+    Phalcon\Test\Benchmark\VoltBenchmark::class,
+    Phalcon\Test\Benchmark\StorageBenchmark::class,
+    Phalcon\Test\Benchmark\ModelBenchmark::class,
+];
+
+$baseline = null;
+
+if (isset($options['compare'])) {
+    $baseline = json_decode((string) file_get_contents($options['compare']), true);
+
+    if (!is_array($baseline) || !isset($baseline['results'])) {
+        fwrite(STDERR, "The report to compare with is not valid\n");
+        exit(1);
+    }
+}
+
+$runner = new Runner(
+    $classes,
+    $options['filter'] ?? null,
+    (int) ($options['revolutions'] ?? 5)
+);
+
+$json = isset($options['json']);
+
+$report = $runner->run(
+    function (string $name) use ($json) {
+        if (!$json) {
+            fwrite(STDERR, '.');
+        }
+    }
+);
+
+if (isset($options['output'])) {
+    file_put_contents(
+        $options['output'],
+        json_encode($report, JSON_PRETTY_PRINT) . PHP_EOL
+    );
+}
+
+if ($json) {
+    echo json_encode($report, JSON_PRETTY_PRINT), PHP_EOL;
+} else {
+    fwrite(STDERR, PHP_EOL . PHP_EOL);
+
+    echo Runner::format($report, $baseline);
+}
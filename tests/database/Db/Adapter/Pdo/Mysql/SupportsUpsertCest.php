@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Db\Adapter\Pdo\Mysql;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Db\Adapter\Pdo\Mysql;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+
+use function getOptionsMysql;
+
+class SupportsUpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Mysql :: supportsUpsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     */
+    public function dbAdapterPdoMysqlSupportsUpsert(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Mysql - supportsUpsert()');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->clear();
+
+        $connection = new Mysql(getOptionsMysql());
+
+        $I->assertTrue($connection->supportsUpsert());
+
+        $I->assertTrue(
+            $connection->upsert(
+                'co_invoices',
+                [10, 'first'],
+                ['inv_id', 'inv_title'],
+                ['inv_id'],
+                ['inv_title']
+            )
+        );
+        $I->assertTrue($connection->lastUpsertInserted());
+
+        /**
+         * The existing row is left unchanged
+         */
+        $I->assertTrue(
+            $connection->upsert(
+                'co_invoices',
+                [10, 'first'],
+                ['inv_id', 'inv_title'],
+                ['inv_id'],
+                ['inv_title']
+            )
+        );
+        $I->assertFalse($connection->lastUpsertInserted());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Mysql :: supportsUpsert() - found rows
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     */
+    public function dbAdapterPdoMysqlSupportsUpsertFoundRows(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Mysql - supportsUpsert() - found rows');
+
+        $options            = getOptionsMysql();
+        $options['options'] = [
+            PDO::MYSQL_ATTR_FOUND_ROWS => true,
+        ];
+
+        $connection = new Mysql($options);
+
+        /**
+         * An unchanged row reports 1 affected row, like an insert
+         */
+        $I->assertFalse($connection->supportsUpsert());
+    }
+}
@@ -145,4 +145,54 @@ class FindCest
         $I->assertEquals(1, $record->obj_id);
         $I->assertEquals('random data', $record->obj_name);
     }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() - with remember cache
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelFindWithRememberCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with remember cache');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new ObjectsMigration($connection);
+        $migration->insert(1, 'random data', 1);
+
+        $serializerFactory = new SerializerFactory();
+        $adapterFactory    = new AdapterFactory($serializerFactory);
+        $adapter           = $adapterFactory->newInstance('memory');
+
+        $this->container->setShared('modelsCache', new Cache($adapter));
+
+        $parameters = [
+            'cache' => [
+                'key'      => 'my-remember-cache',
+                'remember' => true,
+            ],
+        ];
+
+        $data = Objects::find($parameters);
+
+        $I->assertTrue($data->isFresh());
+        $I->assertEquals(1, count($data));
+
+        $data = Objects::find($parameters);
+
+        $I->assertFalse($data->isFresh());
+        $I->assertEquals(1, count($data));
+
+        /**
+         * The resultset is stored as it is under the key
+         */
+        $data = $this->container->get('modelsCache')->get('my-remember-cache');
+
+        $I->assertEquals(1, count($data));
+        $I->assertEquals('random data', $data[0]->obj_name);
+    }
 }
@@ -128,6 +128,54 @@ class FindFirstCest
         );
     }
 
+    /**
+     * Tests Phalcon\Mvc\Model :: findFirstBy() - prepared query reused
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelFindFirstByReused(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - findFirstBy() - prepared query reused');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->insert(4, null, 0, 'inv-four');
+        $migration->insert(5, null, 0, 'inv-five');
+
+        $invoice = Invoices::findFirstByInvTitle('inv-four');
+
+        $I->assertEquals(4, $invoice->inv_id);
+
+        $finder = $this->container
+            ->get('modelsManager')
+            ->getFinder(Invoices::class, 'findFirstByInvTitle')
+        ;
+
+        $I->assertEquals('findFirst', $finder['type']);
+        $I->assertEquals('inv_title', $finder['field']);
+        $I->assertTrue($finder['direct']);
+
+        // Only the bound value changes
+        $invoice = Invoices::findFirstByInvTitle('inv-five');
+
+        $I->assertEquals(5, $invoice->inv_id);
+
+        $I->assertCount(
+            1,
+            Invoices::findByInvTitle('inv-four')
+        );
+
+        $I->assertEquals(
+            1,
+            Invoices::countByInvTitle('inv-five')
+        );
+    }
+
     /**
      * Tests Phalcon\Mvc\Model :: findFirst() - extended
      *
@@ -0,0 +1,87 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\MetaData;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model\MetaData\Stream;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+use function cacheDir;
+
+/**
+ * Class WarmUpCest
+ */
+class WarmUpCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\MetaData :: warmUp() / loadBundle()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelMetadataWarmUp(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\MetaData - warmUp() / loadBundle()');
+
+        $options = [
+            'metaDataDir' => cacheDir(),
+        ];
+
+        $metadata = new Stream($options);
+        $metadata->setDI($this->container);
+
+        $I->assertFalse($metadata->loadBundle('1.0.0'));
+
+        $bundle = $metadata->warmUp([Invoices::class], '1.0.0');
+
+        $I->assertArrayHasKey('meta', $bundle);
+        $I->assertCount(1, $bundle['meta']);
+        $I->assertFileExists(
+            cacheDir('bundle-1.0.0.php')
+        );
+
+        $metadata = new Stream($options);
+        $metadata->setDI($this->container);
+
+        $I->assertTrue($metadata->isEmpty());
+        $I->assertTrue($metadata->loadBundle('1.0.0'));
+        $I->assertFalse($metadata->isEmpty());
+
+        $expected = [
+            'inv_id',
+            'inv_cst_id',
+            'inv_status_flag',
+            'inv_title',
+            'inv_total',
+            'inv_created_at',
+        ];
+        $I->assertEquals($expected, $metadata->getAttributes(new Invoices()));
+
+        $I->safeDeleteFile(cacheDir('bundle-1.0.0.php'));
+        $I->safeDeleteFile(cacheDir('meta-phalcon_test_models_invoices-co_invoices.php'));
+        $I->safeDeleteFile(cacheDir('map-phalcon_test_models_invoices.php'));
+    }
+}
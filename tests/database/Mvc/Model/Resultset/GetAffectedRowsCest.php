@@ -0,0 +1,166 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Resultset;
+
+use DatabaseTester;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Migrations\ObjectsMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+use Phalcon\Test\Models\Objects;
+
+/**
+ * Class GetAffectedRowsCest
+ */
+class GetAffectedRowsCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: getAffectedRows() after update()
+     * and delete()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     */
+    public function mvcModelResultsetGetAffectedRows(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - getAffectedRows()');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+        $migration->insert(1, 1, 0);
+        $migration->insert(2, 1, 0);
+        $migration->insert(3, 1, 0);
+        $migration->insert(4, 2, 0);
+
+        $invoices = Invoices::find('inv_cst_id = 1');
+
+        $I->assertEquals(0, $invoices->getAffectedRows());
+
+        $I->assertTrue(
+            $invoices->update(
+                [
+                    'inv_status_flag' => 1,
+                ]
+            )
+        );
+        $I->assertEquals(3, $invoices->getAffectedRows());
+        $I->assertEquals(
+            3,
+            Invoices::count('inv_status_flag = 1')
+        );
+
+        /**
+         * Only the primary keys were read, the rows can still be iterated
+         */
+        $I->assertEquals(1, $invoices->getFirst()->inv_id);
+        $I->assertCount(3, $invoices->toArray());
+
+        $I->assertTrue($invoices->delete());
+        $I->assertEquals(3, $invoices->getAffectedRows());
+        $I->assertEquals(1, Invoices::count());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: getAffectedRows() with a
+     * condition callback
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     */
+    public function mvcModelResultsetGetAffectedRowsCallback(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - getAffectedRows() - callback');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+        $migration->insert(1, 1, 0);
+        $migration->insert(2, 1, 1);
+
+        $invoices = Invoices::find();
+
+        $I->assertTrue(
+            $invoices->delete(
+                function ($invoice) {
+                    return 1 === (int) $invoice->inv_status_flag;
+                }
+            )
+        );
+        $I->assertEquals(1, $invoices->getAffectedRows());
+        $I->assertEquals(1, Invoices::count());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: getAffectedRows() when update()
+     * sets an empty value to a not null column
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     */
+    public function mvcModelResultsetGetAffectedRowsNotNull(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - getAffectedRows() - not null');
+
+        $connection = $I->getConnection();
+        $migration  = new ObjectsMigration($connection);
+        $migration->clear();
+        $migration->insert(1, 'random data', 1);
+        $migration->insert(2, 'other data', 1);
+
+        $objects = Objects::find();
+
+        /**
+         * The records are saved one by one, so the validation rejects them
+         */
+        $I->assertFalse(
+            $objects->update(
+                [
+                    'obj_name' => '',
+                ]
+            )
+        );
+        $I->assertEquals(0, $objects->getAffectedRows());
+        $I->assertEquals(
+            2,
+            Objects::count("obj_name <> ''")
+        );
+
+        $I->assertFalse(
+            $objects->update(
+                [
+                    'obj_type' => null,
+                ]
+            )
+        );
+        $I->assertEquals(
+            0,
+            Objects::count('obj_type IS NULL')
+        );
+    }
+}
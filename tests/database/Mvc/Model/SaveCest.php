@@ -0,0 +1,136 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+use Phalcon\Test\Models\InvoicesUpsert;
+use Phalcon\Test\Models\InvoicesUpsertUpdate;
+
+/**
+ * Class SaveCest
+ */
+class SaveCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: save() with upserts
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group pgsql
+     */
+    public function mvcModelSaveUpsert(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - save() - upsert');
+
+        $invoice                  = new InvoicesUpsert();
+        $invoice->inv_id          = 10;
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = 0;
+        $invoice->inv_title       = 'first';
+        $invoice->inv_total       = 10;
+
+        $I->assertTrue($invoice->save());
+        $I->assertEquals(Model::DIRTY_STATE_PERSISTENT, $invoice->getDirtyState());
+        $I->assertEquals(Model::OP_CREATE, $invoice->getOperationMade());
+        $I->assertEquals(['afterCreate'], $invoice->afterEvents);
+
+        $I->getConnection()->exec(
+            "UPDATE co_invoices SET inv_created_at = '2020-03-20 10:00:00' WHERE inv_id = 10"
+        );
+
+        /**
+         * A new instance with the same key updates the existing row, without
+         * the values set by the create behaviors
+         */
+        $invoice                  = new InvoicesUpsert();
+        $invoice->inv_id          = 10;
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = 1;
+        $invoice->inv_title       = 'second';
+        $invoice->inv_total       = 20;
+
+        $I->assertTrue($invoice->save());
+        $I->assertEquals(Model::DIRTY_STATE_PERSISTENT, $invoice->getDirtyState());
+        $I->assertEquals(Model::OP_UPDATE, $invoice->getOperationMade());
+        $I->assertEquals(['afterUpdate'], $invoice->afterEvents);
+
+        $I->assertEquals(1, Invoices::count());
+
+        $stored = Invoices::findFirst(10);
+
+        $I->assertEquals('second', $stored->inv_title);
+        $I->assertEquals(1, $stored->inv_status_flag);
+        $I->assertEquals('2020-03-20 10:00:00', $stored->inv_created_at);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: save() with upserts - update events
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group pgsql
+     */
+    public function mvcModelSaveUpsertUpdateEvents(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - save() - upsert - update events');
+
+        $invoice                  = new InvoicesUpsert();
+        $invoice->inv_id          = 10;
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = 0;
+        $invoice->inv_title       = 'first';
+        $invoice->inv_total       = 10;
+
+        $I->assertTrue($invoice->save());
+
+        /**
+         * The model handles beforeUpdate, so the record is checked for
+         * existence and updated instead of upserted
+         */
+        $invoice                  = new InvoicesUpsertUpdate();
+        $invoice->inv_id          = 10;
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = 1;
+        $invoice->inv_title       = 'second';
+        $invoice->inv_total       = 20;
+
+        $I->assertTrue($invoice->save());
+        $I->assertEquals(Model::OP_UPDATE, $invoice->getOperationMade());
+        $I->assertEquals(['beforeUpdate', 'afterUpdate'], $invoice->afterEvents);
+
+        $I->assertEquals(1, Invoices::count());
+        $I->assertEquals('second', Invoices::findFirst(10)->inv_title);
+    }
+}
@@ -0,0 +1,235 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\UnitOfWork;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\UnitOfWork;
+use PDOException;
+use Phalcon\Test\Fixtures\Migrations\CustomersMigration;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Customers;
+use Phalcon\Test\Models\Invoices;
+
+/**
+ * Class FlushCest
+ */
+class FlushCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+
+        $migration = new CustomersMigration($connection);
+        $migration->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\UnitOfWork :: flush()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelUnitOfWorkFlush(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\UnitOfWork - flush()');
+
+        $unitOfWork = new UnitOfWork(2);
+        $invoices   = [];
+
+        for ($id = 1; $id <= 5; $id++) {
+            $invoice                  = new Invoices();
+            $invoice->inv_id          = $id;
+            $invoice->inv_cst_id      = 1;
+            $invoice->inv_status_flag = 0;
+            $invoice->inv_title       = 'invoice-' . $id;
+            $invoice->inv_total       = 10 * $id;
+            $invoice->inv_created_at  = '2020-03-20 10:00:00';
+
+            $unitOfWork->create($invoice);
+
+            $invoices[$id] = $invoice;
+        }
+
+        /**
+         * Records without an id are created one by one
+         */
+        $generated                  = new Invoices();
+        $generated->inv_cst_id      = 2;
+        $generated->inv_status_flag = 0;
+        $generated->inv_title       = 'generated';
+        $generated->inv_total       = 1;
+        $generated->inv_created_at  = '2020-03-20 10:00:00';
+
+        $unitOfWork->create($generated);
+
+        $I->assertCount(6, $unitOfWork);
+        $I->assertTrue($unitOfWork->flush());
+        $I->assertCount(0, $unitOfWork);
+
+        $I->assertEquals(6, Invoices::count());
+        $I->assertNotNull($generated->inv_id);
+        $I->assertEquals(
+            Model::DIRTY_STATE_PERSISTENT,
+            $invoices[1]->getDirtyState()
+        );
+
+        $invoices[1]->inv_title = 'updated-1';
+        $invoices[2]->inv_title = 'updated-2';
+        $invoices[3]->inv_title = null;
+
+        $unitOfWork
+            ->update($invoices[1])
+            ->update($invoices[2])
+            ->update($invoices[3])
+            ->delete($invoices[4])
+            ->delete($invoices[5])
+        ;
+
+        $I->assertTrue($unitOfWork->flush());
+
+        $I->assertEquals(4, Invoices::count());
+        $I->assertEquals('updated-1', Invoices::findFirst(1)->inv_title);
+        $I->assertEquals('updated-2', Invoices::findFirst(2)->inv_title);
+        $I->assertNull(Invoices::findFirst(3)->inv_title);
+        $I->assertEquals(
+            Model::DIRTY_STATE_DETACHED,
+            $invoices[4]->getDirtyState()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\UnitOfWork :: flush() - related records
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelUnitOfWorkFlushRelated(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\UnitOfWork - flush() - related');
+
+        $invoice                  = new Invoices();
+        $invoice->inv_id          = 1;
+        $invoice->inv_status_flag = 0;
+        $invoice->inv_title       = 'related';
+        $invoice->inv_total       = 10;
+        $invoice->inv_created_at  = '2020-03-20 10:00:00';
+
+        $customer                  = new Customers();
+        $customer->cst_status_flag = 1;
+        $customer->cst_name_last   = 'Phalcon';
+        $customer->cst_name_first  = 'Team';
+        $customer->invoices        = [$invoice];
+
+        $I->assertTrue($customer->hasDirtyRelated());
+
+        /**
+         * The customer is created with its invoices, which get its
+         * generated id, and the invoice is not inserted twice
+         */
+        $unitOfWork = new UnitOfWork();
+        $unitOfWork
+            ->create($customer)
+            ->create($invoice)
+        ;
+
+        $I->assertTrue($unitOfWork->flush());
+
+        $I->assertEquals(1, Customers::count());
+        $I->assertEquals(1, Invoices::count());
+        $I->assertNotNull($customer->cst_id);
+        $I->assertEquals(
+            $customer->cst_id,
+            Invoices::findFirst(1)->inv_cst_id
+        );
+        $I->assertEquals(
+            Model::DIRTY_STATE_PERSISTENT,
+            $invoice->getDirtyState()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\UnitOfWork :: flush() - rollback
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     *
+     * @group mysql
+     * @group sqlite
+     */
+    public function mvcModelUnitOfWorkFlushRollback(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\UnitOfWork - flush() - rollback');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->insert(1, 1, 0, 'existing', 10);
+
+        $generated                  = new Invoices();
+        $generated->inv_cst_id      = 1;
+        $generated->inv_status_flag = 0;
+        $generated->inv_title       = 'generated';
+        $generated->inv_total       = 1;
+        $generated->inv_created_at  = '2020-03-20 10:00:00';
+
+        $duplicate                  = new Invoices();
+        $duplicate->inv_id          = 1;
+        $duplicate->inv_cst_id      = 1;
+        $duplicate->inv_status_flag = 0;
+        $duplicate->inv_title       = 'duplicate';
+        $duplicate->inv_total       = 1;
+        $duplicate->inv_created_at  = '2020-03-20 10:00:00';
+
+        $unitOfWork = new UnitOfWork();
+        $unitOfWork
+            ->create($generated)
+            ->create($duplicate)
+        ;
+
+        $thrown = false;
+
+        try {
+            $unitOfWork->flush();
+        } catch (PDOException $ex) {
+            $thrown = true;
+        }
+
+        /**
+         * The generated record was written by create() before the INSERT
+         * failed, and is restored with the transaction
+         */
+        $I->assertTrue($thrown);
+        $I->assertEquals(1, Invoices::count());
+        $I->assertNull($generated->inv_id);
+        $I->assertEquals(
+            Model::DIRTY_STATE_TRANSIENT,
+            $generated->getDirtyState()
+        );
+        $I->assertCount(2, $unitOfWork);
+    }
+}
@@ -0,0 +1,224 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Cache\Cache;
+
+use Phalcon\Cache;
+use Phalcon\Cache\AdapterFactory;
+use Phalcon\Cache\Exception\InvalidArgumentException;
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\SerializerFactory;
+use UnitTester;
+
+use function uniqid;
+
+class RememberCest
+{
+    /**
+     * Tests Phalcon\Cache :: remember()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cacheCacheRemember(UnitTester $I)
+    {
+        $I->wantToTest('Cache\Cache - remember()');
+
+        $serializer = new SerializerFactory();
+        $factory    = new AdapterFactory($serializer);
+        $instance   = $factory->newInstance('memory');
+
+        $adapter = new Cache($instance);
+
+        $key   = uniqid();
+        $calls = 0;
+
+        $callback = function () use (&$calls) {
+            $calls++;
+
+            return 'test';
+        };
+
+        $I->assertEquals(
+            'test',
+            $adapter->remember($key, 100, $callback, ['beta' => 0])
+        );
+
+        $I->assertEquals(
+            'test',
+            $adapter->remember($key, 100, $callback, ['beta' => 0])
+        );
+
+        $I->assertEquals(1, $calls);
+        $I->assertTrue(
+            $adapter->has($key)
+        );
+
+        $I->assertEquals(
+            'test',
+            $adapter->get($key)
+        );
+
+        $I->assertEquals(
+            'test',
+            $instance->get($key)
+        );
+    }
+
+    /**
+     * Tests Phalcon\Cache :: remember() - stale value served while locked
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cacheCacheRememberStale(UnitTester $I)
+    {
+        $I->wantToTest('Cache\Cache - remember() - stale');
+
+        $serializer = new SerializerFactory();
+        $factory    = new AdapterFactory($serializer);
+        $instance   = $factory->newInstance('memory');
+
+        $adapter = new Cache($instance);
+        $key     = uniqid();
+
+        $adapter->remember(
+            $key,
+            -1,
+            function () {
+                return 'stale';
+            },
+            ['stale' => 100]
+        );
+
+        /**
+         * Someone else is refreshing the item
+         */
+        $I->assertTrue(
+            $instance->lock($key)
+        );
+
+        $I->assertEquals(
+            'stale',
+            $adapter->remember(
+                $key,
+                100,
+                function () {
+                    return 'fresh';
+                },
+                ['stale' => 100]
+            )
+        );
+
+        $I->assertTrue(
+            $instance->unlock($key)
+        );
+
+        $I->assertEquals(
+            'fresh',
+            $adapter->remember(
+                $key,
+                100,
+                function () {
+                    return 'fresh';
+                },
+                ['stale' => 100]
+            )
+        );
+    }
+
+    /**
+     * Tests Phalcon\Cache :: remember() - value stored while waiting for the
+     * lock
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cacheCacheRememberStoredBeforeLock(UnitTester $I)
+    {
+        $I->wantToTest('Cache\Cache - remember() - stored before the lock');
+
+        /**
+         * Another worker stores the value between the read and the lock
+         */
+        $instance = new class (new SerializerFactory()) extends Memory {
+            public function lock(string $key, int $ttl = 30): bool
+            {
+                $this->set($key, 'other');
+                $this->set(
+                    $this->getRememberKey($key),
+                    [
+                        'delta'   => 0.0,
+                        'expires' => microtime(true) + 100,
+                    ]
+                );
+
+                return parent::lock($key, $ttl);
+            }
+        };
+
+        $adapter = new Cache($instance);
+        $key     = uniqid();
+        $calls   = 0;
+
+        $I->assertEquals(
+            'other',
+            $adapter->remember(
+                $key,
+                100,
+                function () use (&$calls) {
+                    $calls++;
+
+                    return 'test';
+                },
+                ['beta' => 0]
+            )
+        );
+
+        $I->assertEquals(0, $calls);
+
+        // The lock is released
+        $I->assertTrue(
+            $instance->lock($key)
+        );
+    }
+
+    /**
+     * Tests Phalcon\Cache :: remember() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cacheCacheRememberException(UnitTester $I)
+    {
+        $I->wantToTest('Cache\Cache - remember() - exception');
+
+        $I->expectThrowable(
+            new InvalidArgumentException('The key contains invalid characters'),
+            function () {
+                $serializer = new SerializerFactory();
+                $factory    = new AdapterFactory($serializer);
+                $instance   = $factory->newInstance('memory');
+
+                $adapter = new Cache($instance);
+                $adapter->remember(
+                    'abc$^',
+                    100,
+                    function () {
+                        return 'test';
+                    }
+                );
+            }
+        );
+    }
+}
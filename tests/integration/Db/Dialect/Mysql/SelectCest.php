@@ -0,0 +1,82 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+
+class SelectCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: select() - cached per bindCounts
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function dbDialectMysqlSelectCached(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - select() - cached per bindCounts');
+
+        $definition = [
+            'cacheId'    => 7,
+            'tables'     => 'robots',
+            'columns'    => [
+                ['id'],
+                ['name'],
+            ],
+            'where'      => [
+                'type'  => 'binary-op',
+                'op'    => 'IN',
+                'left'  => [
+                    'type' => 'qualified',
+                    'name' => 'id',
+                ],
+                'right' => [
+                    'type' => 'list',
+                    [
+                        [
+                            'type'     => 'placeholder',
+                            'value'    => ':ids',
+                            'rawValue' => 'ids',
+                            'times'    => 1,
+                        ],
+                    ],
+                ],
+            ],
+            'bindCounts' => [
+                'ids' => 2,
+            ],
+        ];
+
+        $mysql = new Mysql();
+
+        $expected = 'SELECT `id`, `name` FROM `robots` WHERE `id` IN (:ids0, :ids1)';
+        $I->assertSame($expected, $mysql->select($definition));
+        $I->assertSame($expected, $mysql->select($definition));
+
+        $definition['bindCounts']['ids'] = 3;
+
+        $expected = 'SELECT `id`, `name` FROM `robots` WHERE `id` IN (:ids0, :ids1, :ids2)';
+        $I->assertSame($expected, $mysql->select($definition));
+
+        $mysql->registerCustomFunction(
+            'MY_FUNCTION',
+            function () {
+                return 'MY_FUNCTION()';
+            }
+        );
+
+        $I->assertSame($expected, $mysql->select($definition));
+    }
+}
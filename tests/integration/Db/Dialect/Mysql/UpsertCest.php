@@ -0,0 +1,59 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+
+class UpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function dbDialectMysqlUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - upsert()');
+
+        $mysql = new Mysql();
+
+        $I->assertTrue($mysql->supportsUpsert());
+
+        $expected = 'INSERT INTO `schema`.`robots` (`id`, `name`, `year`) '
+            . 'VALUES (?, ?, ?) ON DUPLICATE KEY UPDATE '
+            . '`name` = VALUES(`name`), `year` = VALUES(`year`)';
+
+        $I->assertSame(
+            $expected,
+            $mysql->upsert(
+                'robots',
+                ['id', 'name', 'year'],
+                ['?', '?', '?'],
+                ['id'],
+                ['name', 'year'],
+                'schema'
+            )
+        );
+
+        $expected = 'INSERT INTO `robots` (`id`) VALUES (?) '
+            . 'ON DUPLICATE KEY UPDATE `id` = `id`';
+
+        $I->assertSame(
+            $expected,
+            $mysql->upsert('robots', ['id'], ['?'], ['id'], [])
+        );
+    }
+}
@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Dialect\Sqlite;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Sqlite;
+
+class UpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Sqlite :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function dbDialectSqliteUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Sqlite - upsert()');
+
+        $sqlite = new Sqlite();
+
+        $I->assertTrue($sqlite->supportsUpsert());
+
+        $expected = 'INSERT INTO "robots" ("id") VALUES (?) '
+            . 'ON CONFLICT ("id") DO NOTHING';
+
+        $I->assertSame(
+            $expected,
+            $sqlite->upsert('robots', ['id'], ['?'], ['id'], [])
+        );
+    }
+}
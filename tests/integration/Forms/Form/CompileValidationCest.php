@@ -0,0 +1,164 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Forms\Form;
+
+use IntegrationTester;
+use Phalcon\Forms\Element\Text;
+use Phalcon\Forms\Form;
+use Phalcon\Test\Fixtures\Forms\SharedValidationForm;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Validation\Validator\PresenceOf;
+use Phalcon\Validation\Validator\StringLength;
+
+/**
+ * Class CompileValidationCest
+ */
+class CompileValidationCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newDi();
+        $this->setDiService('escaper');
+        $this->setDiService('url');
+    }
+
+    /**
+     * Tests Phalcon\Forms\Form :: compileValidation()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function formsFormCompileValidation(IntegrationTester $I)
+    {
+        $I->wantToTest('Forms\Form - compileValidation()');
+
+        $name = new Text('name');
+
+        $name->addValidator(
+            new PresenceOf(
+                [
+                    'message' => 'The name is required',
+                ]
+            )
+        );
+
+        $form = new Form();
+
+        $form->add($name);
+
+        $validation = $form->compileValidation();
+
+        $I->assertSame(
+            $validation,
+            $form->compileValidation()
+        );
+
+        // The compiled validation is reused with each run's own data
+        $I->assertFalse(
+            $form->isValid(['name' => ''])
+        );
+
+        $I->assertTrue(
+            $form->isValid(['name' => 'Phalcon'])
+        );
+
+        $I->assertSame(
+            $validation,
+            $form->compileValidation()
+        );
+
+        // Changing the validators of an element compiles it again
+        $name->addValidator(
+            new StringLength(
+                [
+                    'min'            => 10,
+                    'messageMinimum' => 'The name is too short',
+                ]
+            )
+        );
+
+        $I->assertNotSame(
+            $validation,
+            $form->compileValidation()
+        );
+
+        $I->assertFalse(
+            $form->isValid(['name' => 'Phalcon'])
+        );
+
+        $I->assertSame(
+            'The name is too short',
+            $form->getMessages()->current()->getMessage()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Forms\Form :: compileValidation() - shared
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function formsFormCompileValidationShared(IntegrationTester $I)
+    {
+        $I->wantToTest('Forms\Form - compileValidation() - shared');
+
+        $first  = new SharedValidationForm();
+        $second = new SharedValidationForm();
+
+        $validation = $first->compileValidation();
+
+        $I->assertSame(
+            $validation,
+            $second->compileValidation()
+        );
+
+        /**
+         * A form changed after it was initialized compiles its own
+         * validation and leaves the shared one to the others
+         */
+        $email = new Text('email');
+
+        $email->addValidator(
+            new PresenceOf(
+                [
+                    'message' => 'The email is required',
+                ]
+            )
+        );
+
+        $second->add($email);
+
+        $I->assertNotSame(
+            $validation,
+            $second->compileValidation()
+        );
+
+        $I->assertFalse(
+            $second->isValid(['name' => 'Phalcon'])
+        );
+
+        $I->assertTrue(
+            $first->isValid(['name' => 'Phalcon'])
+        );
+
+        $I->assertSame(
+            $validation,
+            (new SharedValidationForm())->compileValidation()
+        );
+
+        $first->resetValidation(true);
+    }
+}
@@ -0,0 +1,144 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Dispatcher;
+
+use IntegrationTester;
+use Phalcon\Dispatcher\Exception;
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Test\Integration\Mvc\Dispatcher\Helper\BaseDispatcher;
+use Phalcon\Test\Integration\Mvc\Dispatcher\Helper\DispatcherTestDefaultController;
+
+use function get_class;
+use function md5;
+
+class SetDispatchPlansCacheCest extends BaseDispatcher
+{
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: setDispatchPlansCache()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function mvcDispatcherSetDispatchPlansCache(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - setDispatchPlansCache()');
+
+        $cache      = new Memory(new SerializerFactory());
+        $dispatcher = $this->getDispatcher();
+
+        $dispatcher->setDispatchPlansCache($cache, '1.0');
+
+        $expected = [
+            'beforeDispatchLoop',
+            'beforeDispatch',
+            'beforeExecuteRoute',
+            'beforeExecuteRoute-method',
+            'initialize-method',
+            'afterInitialize',
+            'indexAction',
+            'afterExecuteRoute',
+            'afterExecuteRoute-method',
+            'afterDispatch',
+            'afterDispatchLoop',
+        ];
+
+        $I->assertInstanceOf(
+            DispatcherTestDefaultController::class,
+            $dispatcher->dispatch()
+        );
+
+        $I->assertEquals(
+            $expected,
+            $this->getDispatcherListener()->getTrace()
+        );
+
+        $cached = $cache->get(
+            'dispatch-plans-' . md5(get_class($dispatcher) . ':1.0')
+        );
+
+        $I->assertCount(1, $cached['plans']);
+        $I->assertCount(1, $cached['methods']);
+
+        $plan = current($cached['plans']);
+
+        $I->assertEquals(
+            DispatcherTestDefaultController::class,
+            $plan['handlerClass']
+        );
+        $I->assertEquals('indexAction', $plan['actionMethod']);
+
+        /**
+         * Dispatching again reuses the plan; the handler is already
+         * initialized
+         */
+        $this->getDispatcherListener()->clearTrace();
+
+        $dispatcher->dispatch();
+
+        $expected = [
+            'beforeDispatchLoop',
+            'beforeDispatch',
+            'beforeExecuteRoute',
+            'beforeExecuteRoute-method',
+            'indexAction',
+            'afterExecuteRoute',
+            'afterExecuteRoute-method',
+            'afterDispatch',
+            'afterDispatchLoop',
+        ];
+
+        $I->assertEquals(
+            $expected,
+            $this->getDispatcherListener()->getTrace()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: setDispatchPlansCache() - missing
+     * actions
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function mvcDispatcherSetDispatchPlansCacheMissingAction(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - setDispatchPlansCache() - missing action');
+
+        $cache      = new Memory(new SerializerFactory());
+        $dispatcher = $this->getDispatcher();
+
+        $dispatcher->setDispatchPlansCache($cache, '1.0');
+        $dispatcher->setActionName('Invalid-Dispatcher-Action-Name');
+
+        $I->expectThrowable(
+            new Exception(
+                "Action 'Invalid-Dispatcher-Action-Name' was not found on handler 'dispatcher-test-default'",
+                Exception::EXCEPTION_ACTION_NOT_FOUND
+            ),
+            function () use ($dispatcher) {
+                $dispatcher->dispatch();
+            }
+        );
+
+        /**
+         * Plans are only kept for actions that exist
+         */
+        $I->assertEquals([], $I->getProtectedProperty($dispatcher, 'dispatchPlans'));
+        $I->assertEquals([], $I->getProtectedProperty($dispatcher, 'handlerMethods'));
+        $I->assertFalse(
+            $cache->has('dispatch-plans-' . md5(get_class($dispatcher) . ':1.0'))
+        );
+    }
+}
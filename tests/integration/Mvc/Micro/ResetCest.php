@@ -0,0 +1,70 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Micro;
+
+use IntegrationTester;
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Mvc\Micro;
+use Phalcon\Tag;
+
+class ResetCest
+{
+    /**
+     * Tests Phalcon\Mvc\Micro :: reset()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function mvcMicroReset(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Micro - reset()');
+
+        $container = new FactoryDefault();
+        $micro     = new Micro($container);
+
+        $micro->map(
+            '/hello/{name}',
+            function ($name) use ($container) {
+                Tag::setDefault('name', $name);
+
+                $container->get('response')->setHeader('X-Name', $name);
+
+                return 'Hi ' . ucfirst($name) . '!';
+            }
+        );
+
+        foreach (['sid', 'nikos'] as $name) {
+            // Micro echoes out its result as well
+            ob_start();
+            $result = $micro->handle('/hello/' . $name);
+            ob_end_clean();
+
+            $I->assertEquals('Hi ' . ucfirst($name) . '!', $result);
+            $I->assertTrue(Tag::hasValue('name'));
+            $I->assertEquals(
+                $name,
+                $container->get('response')->getHeaders()->get('X-Name')
+            );
+
+            $micro->reset();
+
+            $I->assertNull($micro->getReturnedValue());
+            $I->assertFalse(Tag::hasValue('name'));
+            $I->assertFalse($micro->getRouter()->wasMatched());
+            $I->assertFalse(
+                $container->get('response')->getHeaders()->get('X-Name')
+            );
+        }
+    }
+}
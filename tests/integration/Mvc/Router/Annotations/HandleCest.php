@@ -14,12 +14,23 @@ declare(strict_types=1);
 namespace Phalcon\Test\Integration\Mvc\Router\Annotations;
 
 use IntegrationTester;
+use Phalcon\Mvc\Router\Annotations;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
 
 /**
  * Class HandleCest
  */
 class HandleCest
 {
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newDi();
+        $this->setDiService('request');
+        $this->setDiService('annotations');
+    }
+
     /**
      * Tests Phalcon\Mvc\Router\Annotations :: handle()
      *
@@ -29,6 +40,53 @@ class HandleCest
     public function mvcRouterAnnotationsHandle(IntegrationTester $I)
     {
         $I->wantToTest('Mvc\Router\Annotations - handle()');
-        $I->skipTest('Need implementation');
+
+        $router = new Annotations(false);
+        $router->setDI($this->getDi());
+
+        $router->addResource('Phalcon\Test\Controllers\Products', '/products');
+
+        /**
+         * Without a routes cache the annotations are only read for the
+         * resources whose prefix matches; this class does not exist
+         */
+        $router->addResource('Phalcon\Test\Controllers\Missing', '/missing');
+
+        $router->handle('/products');
+
+        $I->assertTrue($router->wasMatched());
+        $I->assertEquals('products', $router->getControllerName());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router\Annotations :: handle() - routes added once
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function mvcRouterAnnotationsHandleTwice(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router\Annotations - handle() - twice');
+
+        $router = new Annotations(false);
+        $router->setDI($this->getDi());
+
+        $router->addResource('Phalcon\Test\Controllers\Products', '/products');
+
+        $router->handle('/products');
+        $expected = count($router->getRoutes());
+
+        $router->handle('/products');
+
+        $I->assertTrue($router->wasMatched());
+        $I->assertCount($expected, $router->getRoutes());
+
+        /**
+         * Changing the resources drops the routes added from them
+         */
+        $router->setControllerSuffix('Controller');
+        $router->handle('/products');
+
+        $I->assertCount($expected, $router->getRoutes());
     }
 }
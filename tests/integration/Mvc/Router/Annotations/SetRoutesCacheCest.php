@@ -0,0 +1,93 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Router\Annotations;
+
+use IntegrationTester;
+use Phalcon\Mvc\Router\Annotations;
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+
+class SetRoutesCacheCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newDi();
+        $this->setDiService('request');
+        $this->setDiService('annotations');
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router\Annotations :: setRoutesCache()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function mvcRouterAnnotationsSetRoutesCache(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router\Annotations - setRoutesCache()');
+
+        $container = $this->getDi();
+        $cache     = new Memory(new SerializerFactory());
+
+        $router = new Annotations(false);
+        $router->setDI($container);
+        $router->setRoutesCache($cache, '1.0.0');
+
+        $router->addResource('Phalcon\Test\Controllers\Robots', '/');
+        $router->addResource('Phalcon\Test\Controllers\Products', '/products');
+        $router->addResource('Phalcon\Test\Controllers\About', '/about');
+
+        $router->handle('/products');
+
+        $I->assertCount(6, $router->getRoutes());
+        $I->assertCount(1, $cache->getKeys());
+
+        /**
+         * The route table comes from the cache, the annotations are not read
+         */
+        $container->remove('annotations');
+
+        $router = new Annotations(false);
+        $router->setDI($container);
+        $router->setRoutesCache($cache, '1.0.0');
+
+        $router->addResource('Phalcon\Test\Controllers\Robots', '/');
+        $router->addResource('Phalcon\Test\Controllers\Products', '/products');
+        $router->addResource('Phalcon\Test\Controllers\About', '/about');
+
+        $router->handle('/products');
+
+        $I->assertCount(6, $router->getRoutes());
+        $I->assertTrue($router->wasMatched());
+        $I->assertEquals('products', $router->getControllerName());
+
+        /**
+         * A new version builds the route table again
+         */
+        $this->setDiService('annotations');
+
+        $router = new Annotations(false);
+        $router->setDI($container);
+        $router->setRoutesCache($cache, '1.0.1');
+
+        $router->addResource('Phalcon\Test\Controllers\About', '/about');
+
+        $router->handle('/about');
+
+        $I->assertCount(2, $cache->getKeys());
+    }
+}
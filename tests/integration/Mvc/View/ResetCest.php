@@ -14,6 +14,7 @@ declare(strict_types=1);
 namespace Phalcon\Test\Integration\Mvc\View;
 
 use IntegrationTester;
+use Phalcon\Mvc\View;
 
 /**
  * Class ResetCest
@@ -29,6 +30,25 @@ class ResetCest
     public function mvcViewReset(IntegrationTester $I)
     {
         $I->wantToTest('Mvc\View - reset()');
-        $I->skipTest('Need implementation');
+
+        $view = new View();
+
+        $view->setContent('<h1>hello</h1>');
+        $view->setVar('name', 'Phalcon');
+        $view->pick('products/index');
+        $view->setTemplateBefore('before');
+        $view->setTemplateAfter('after');
+        $view->setRenderLevel(View::LEVEL_ACTION_VIEW);
+        $view->disable();
+
+        $I->assertSame($view, $view->reset());
+
+        $I->assertEquals('', $view->getContent());
+        $I->assertEquals([], $view->getParamsToView());
+        $I->assertNull($I->getProtectedProperty($view, 'pickView'));
+        $I->assertEquals([], $I->getProtectedProperty($view, 'templatesBefore'));
+        $I->assertEquals([], $I->getProtectedProperty($view, 'templatesAfter'));
+        $I->assertEquals(View::LEVEL_MAIN_LAYOUT, $view->getRenderLevel());
+        $I->assertFalse($view->isDisabled());
     }
 }
@@ -0,0 +1,74 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Storage\Adapter\Stream;
+
+use Phalcon\Storage\Adapter\Stream;
+use Phalcon\Storage\SerializerFactory;
+use UnitTester;
+
+use function outputDir;
+use function uniqid;
+
+class LockCest
+{
+    /**
+     * Tests Phalcon\Storage\Adapter\Stream :: lock()/unlock()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageAdapterStreamLockUnlock(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Adapter\Stream - lock()/unlock()');
+
+        $serializer = new SerializerFactory();
+        $options    = [
+            'storageDir' => outputDir() . 'tests/stream/',
+        ];
+
+        $first  = new Stream($serializer, $options);
+        $second = new Stream($serializer, $options);
+
+        $key = uniqid();
+
+        $I->assertTrue(
+            $first->lock($key)
+        );
+
+        $I->assertFalse(
+            $second->lock($key)
+        );
+
+        $I->assertFalse(
+            $second->unlock($key)
+        );
+
+        $I->assertTrue(
+            $first->unlock($key)
+        );
+
+        $I->assertTrue(
+            $second->lock($key)
+        );
+
+        $I->assertTrue(
+            $second->unlock($key)
+        );
+
+        $I->assertEquals(
+            [],
+            $first->getKeys()
+        );
+    }
+}
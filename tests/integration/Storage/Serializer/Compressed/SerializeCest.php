@@ -0,0 +1,139 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Storage\Serializer\Compressed;
+
+use Phalcon\Storage\Exception;
+use Phalcon\Storage\Serializer\Compressed;
+use Phalcon\Storage\Serializer\Php;
+use UnitTester;
+
+use function chr;
+use function function_exists;
+use function ord;
+use function serialize;
+use function str_repeat;
+use function strlen;
+
+class SerializeCest
+{
+    /**
+     * Tests Phalcon\Storage\Serializer\Compressed :: serialize() - small
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerCompressedSerializeSmall(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Compressed - serialize() - small');
+
+        $serializer = new Compressed('Phalcon Framework');
+
+        $I->assertEquals(
+            chr(Compressed::CODEC_NONE) . serialize('Phalcon Framework'),
+            $serializer->serialize()
+        );
+
+        $serializer = new Compressed(1234);
+
+        $I->assertEquals(
+            1234,
+            $serializer->serialize()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Storage\Serializer\Compressed :: serialize()/unserialize()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerCompressedSerializeLarge(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Compressed - serialize() - large');
+
+        $data       = ['payload' => str_repeat('Phalcon Framework ', 1000)];
+        $serializer = new Compressed($data, new Php(), 512);
+        $serialized = $serializer->serialize();
+
+        $I->assertLessThan(
+            strlen(serialize($data)),
+            strlen($serialized)
+        );
+
+        $serializer = new Compressed(null, new Php(), 512);
+        $serializer->unserialize($serialized);
+
+        $I->assertEquals(
+            $data,
+            $serializer->getData()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Storage\Serializer\Compressed :: unserialize() - legacy
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerCompressedUnserializeLegacy(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Compressed - unserialize() - legacy');
+
+        $serializer = new Compressed();
+        $serializer->unserialize(serialize(['Phalcon']));
+
+        $I->assertEquals(
+            ['Phalcon'],
+            $serializer->getData()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Storage\Serializer\Compressed :: serialize() - codec
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerCompressedSerializeCodec(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Compressed - serialize() - codec');
+
+        $data       = str_repeat('Phalcon Framework ', 1000);
+        $serializer = new Compressed($data, new Php(), 512);
+
+        // zlib unless another codec is chosen
+        $I->assertEquals(
+            Compressed::CODEC_ZLIB,
+            ord($serializer->serialize())
+        );
+
+        if (!function_exists('zstd_uncompress')) {
+            // Entries written by a host with zstd are a miss
+            $serializer->unserialize(
+                chr(Compressed::CODEC_ZSTD) . 'compressed payload'
+            );
+
+            $I->assertNull(
+                $serializer->getData()
+            );
+
+            $I->expectThrowable(
+                new Exception('The codec 4 is not supported or its extension is not loaded'),
+                function () {
+                    new Compressed(null, new Php(), 512, -1, Compressed::CODEC_ZSTD);
+                }
+            );
+        }
+    }
+}
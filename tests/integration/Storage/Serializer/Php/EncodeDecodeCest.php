@@ -0,0 +1,136 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Storage\Serializer\Php;
+
+use ErrorException;
+use Phalcon\Storage\Serializer\Php;
+use UnitTester;
+
+use function restore_error_handler;
+use function serialize;
+use function set_error_handler;
+
+class EncodeDecodeCest
+{
+    /**
+     * Tests Phalcon\Storage\Serializer\Php :: encode()/decode()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerPhpEncodeDecode(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Php - encode()/decode()');
+
+        $serializer = new Php('state');
+
+        $I->assertEquals(
+            serialize(['Phalcon Framework']),
+            $serializer->encode(['Phalcon Framework'])
+        );
+
+        $I->assertEquals(
+            ['Phalcon Framework'],
+            $serializer->decode(serialize(['Phalcon Framework']))
+        );
+
+        $I->assertEquals(
+            1234,
+            $serializer->encode(1234)
+        );
+
+        /**
+         * The data of the serializer is left alone
+         */
+        $I->assertEquals(
+            'state',
+            $serializer->getData()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Storage\Serializer\Php :: decode() - error
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerPhpDecodeError(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Php - decode() - error');
+
+        $serializer = new Php();
+
+        $I->assertNull(
+            $serializer->decode('{??hello?unserialize"')
+        );
+
+        $I->assertFalse(
+            $serializer->decode(serialize(false))
+        );
+    }
+
+    /**
+     * Tests Phalcon\Storage\Serializer\Php :: decode() - error handler
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function storageSerializerPhpDecodeErrorHandler(UnitTester $I)
+    {
+        $I->wantToTest('Storage\Serializer\Php - decode() - error handler');
+
+        $serializer = new Php();
+        $level      = error_reporting();
+
+        /**
+         * Neither a handler swallowing the notice nor one throwing the
+         * reported errors changes the result
+         */
+        set_error_handler(
+            function () {
+                return true;
+            }
+        );
+
+        $I->assertNull(
+            $serializer->decode('{??hello?unserialize"')
+        );
+
+        restore_error_handler();
+
+        set_error_handler(
+            function (int $number, string $message) {
+                if (!(error_reporting() & $number)) {
+                    return false;
+                }
+
+                throw new ErrorException($message, 0, $number);
+            }
+        );
+
+        $I->assertNull(
+            $serializer->decode('{??hello?unserialize"')
+        );
+
+        $I->assertEquals(
+            ['Phalcon Framework'],
+            $serializer->decode(serialize(['Phalcon Framework']))
+        );
+
+        restore_error_handler();
+
+        // The reporting level is restored
+        $I->assertSame($level, error_reporting());
+    }
+}
@@ -16,6 +16,7 @@ namespace Phalcon\Test\Integration\Storage\SerializerFactory;
 use Codeception\Example;
 use Phalcon\Factory\Exception;
 use Phalcon\Storage\Serializer\Base64;
+use Phalcon\Storage\Serializer\Compressed;
 use Phalcon\Storage\Serializer\Igbinary;
 use Phalcon\Storage\Serializer\Json;
 use Phalcon\Storage\Serializer\Msgpack;
@@ -74,6 +75,7 @@ class NewInstanceCest
     {
         return [
             ['base64', Base64::class],
+            ['compressed', Compressed::class],
             ['igbinary', Igbinary::class],
             ['json', Json::class],
             ['msgpack', Msgpack::class],
@@ -0,0 +1,73 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Validation;
+
+use ArrayIterator;
+use IntegrationTester;
+use Phalcon\Messages\Message;
+use Phalcon\Messages\Messages;
+use Phalcon\Validation;
+use Phalcon\Validation\Validator\PresenceOf;
+
+/**
+ * Class ValidateManyCest
+ */
+class ValidateManyCest
+{
+    /**
+     * Tests Phalcon\Validation :: validateMany()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function validationValidateMany(IntegrationTester $I)
+    {
+        $I->wantToTest('Validation - validateMany()');
+
+        $validation = new Validation();
+
+        $validation->add('name', new PresenceOf());
+
+        $results = $validation->validateMany(
+            new ArrayIterator(
+                [
+                    'first'  => ['name' => 'Leia'],
+                    'second' => ['name' => ''],
+                    'third'  => ['name' => 'Luke'],
+                ]
+            )
+        );
+
+        $I->assertEquals(
+            ['first', 'second', 'third'],
+            array_keys($results)
+        );
+
+        $I->assertCount(0, $results['first']);
+        $I->assertCount(0, $results['third']);
+
+        $expected = new Messages(
+            [
+                new Message(
+                    'Field name is required',
+                    'name',
+                    PresenceOf::class,
+                    0
+                ),
+            ]
+        );
+
+        $I->assertEquals($expected, $results['second']);
+    }
+}
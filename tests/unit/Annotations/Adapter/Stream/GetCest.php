@@ -59,6 +59,6 @@ class GetCest
             $classAnnotations->getClassAnnotations()
         );
 
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
@@ -51,6 +51,6 @@ class GetMethodCest
             $methodAnnotation
         );
 
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
@@ -64,6 +64,6 @@ class GetMethodsCest
             );
         }
 
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
@@ -63,6 +63,6 @@ class GetPropertiesCest
             );
         }
 
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
@@ -51,6 +51,6 @@ class GetPropertyCest
             $propertyAnnotation
         );
 
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
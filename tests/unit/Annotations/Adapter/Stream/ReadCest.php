@@ -19,7 +19,11 @@ use TestClass;
 use UnitTester;
 
 use function dataDir;
+use function file_put_contents;
+use function ob_get_clean;
+use function ob_start;
 use function outputDir;
+use function serialize;
 
 class ReadCest
 {
@@ -49,7 +53,7 @@ class ReadCest
         $adapter->write('testwrite', $classAnnotations);
 
         $I->assertFileExists(
-            outputDir('tests/annotations/testclass.php')
+            outputDir('tests/annotations/testclass.annotations.php')
         );
 
         $newClass = $adapter->read('testwrite');
@@ -58,7 +62,59 @@ class ReadCest
             $newClass
         );
 
-        $I->safeDeleteFile('testwrite.php');
+        $I->safeDeleteFile('testwrite.annotations.php');
+        $I->safeDeleteFile('testclass.annotations.php');
+    }
+
+    /**
+     * Tests Phalcon\Annotations\Adapter\Stream :: read() - previous format
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function annotationsAdapterStreamReadPreviousFormat(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Adapter\Stream - read() - previous format');
+
+        require_once dataDir('fixtures/Annotations/TestClass.php');
+
+        $adapter = new Stream(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        /**
+         * Files used to hold a serialized Reflection
+         */
+        file_put_contents(
+            outputDir('tests/annotations/testclass.php'),
+            serialize(new Reflection())
+        );
+
+        ob_start();
+
+        $I->assertFalse(
+            $adapter->read(TestClass::class)
+        );
+
+        $I->assertEquals('', ob_get_clean());
+
+        /**
+         * The file is parsed and written under its new name
+         */
+        $I->assertInstanceOf(
+            Reflection::class,
+            $adapter->get(TestClass::class)
+        );
+
+        $I->openFile(
+            outputDir('tests/annotations/testclass.annotations.php')
+        );
+
+        $I->seeInThisFile('<?php return array (');
+
         $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
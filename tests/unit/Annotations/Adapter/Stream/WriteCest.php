@@ -48,10 +48,54 @@ class WriteCest
         $adapter->write('testwrite', $classAnnotations);
 
         $I->assertFileExists(
-            outputDir('tests/annotations/testclass.php')
+            outputDir('tests/annotations/testclass.annotations.php')
         );
 
-        $I->safeDeleteFile('testwrite.php');
-        $I->safeDeleteFile('testclass.php');
+        $I->safeDeleteFile('testwrite.annotations.php');
+        $I->safeDeleteFile('testclass.annotations.php');
+    }
+
+    /**
+     * Tests Phalcon\Annotations\Adapter\Stream :: write() - exported array
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function annotationsAdapterStreamWriteExportedArray(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Adapter\Stream - write() - exported array');
+
+        require_once dataDir('fixtures/Annotations/TestClass.php');
+
+        $adapter = new Stream(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        $classAnnotations = $adapter->get(
+            TestClass::class
+        );
+
+        $adapter->write('testwrite', $classAnnotations);
+
+        $I->openFile(
+            outputDir('tests/annotations/testwrite.annotations.php')
+        );
+
+        $I->seeInThisFile('<?php return array (');
+
+        $I->assertEquals(
+            $classAnnotations->getReflectionData(),
+            require outputDir('tests/annotations/testwrite.annotations.php')
+        );
+
+        $I->assertEquals(
+            $classAnnotations->getReflectionData(),
+            $adapter->read('testwrite')->getReflectionData()
+        );
+
+        $I->safeDeleteFile('testwrite.annotations.php');
+        $I->safeDeleteFile('testclass.annotations.php');
     }
 }
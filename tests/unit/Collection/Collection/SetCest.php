@@ -58,4 +58,30 @@ class SetCest
             $collection->get('three')
         );
     }
+
+    /**
+     * Tests Phalcon\Collection :: set() - different case
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function collectionSetDifferentCase(UnitTester $I)
+    {
+        $I->wantToTest('Collection - set() - different case');
+
+        $collection = new Collection();
+
+        $collection->set('three', 'two');
+        $collection->set('THREE', 'Phalcon');
+
+        $I->assertEquals(
+            [
+                'THREE' => 'Phalcon',
+            ],
+            $collection->toArray()
+        );
+
+        $I->assertEquals('Phalcon', $collection->get('three'));
+        $I->assertEquals('Phalcon', $collection->get('THREE'));
+    }
 }
@@ -13,6 +13,7 @@ declare(strict_types=1);
 
 namespace Phalcon\Test\Unit\Config\Config;
 
+use Phalcon\Config;
 use Phalcon\Test\Fixtures\Traits\ConfigTrait;
 use UnitTester;
 
@@ -51,4 +52,42 @@ class GetCest
             $this->config['database']['adapter']
         );
     }
+
+    /**
+     * Tests Phalcon\Config :: get() - nested arrays converted on access
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function configGetLazy(UnitTester $I)
+    {
+        $I->wantToTest('Config - get() - nested arrays converted on access');
+
+        $config = new Config(
+            [
+                'database' => [
+                    'adapter' => 'Mysql',
+                    'options' => [
+                        'persistent' => true,
+                    ],
+                ],
+            ]
+        );
+
+        $database = $config->get('database');
+
+        $I->assertInstanceOf(Config::class, $database);
+        $I->assertSame($database, $config->get('DATABASE'));
+        $I->assertSame($database, $config->database);
+
+        $database->adapter = 'Sqlite';
+
+        $I->assertEquals('Sqlite', $config->path('database.adapter'));
+        $I->assertTrue($config->path('database.options.persistent'));
+        $I->assertNull($config->path('database.adapter.unknown'));
+
+        foreach ($config as $value) {
+            $I->assertInstanceOf(Config::class, $value);
+        }
+    }
 }
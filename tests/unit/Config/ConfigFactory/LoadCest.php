@@ -13,6 +13,7 @@ declare(strict_types=1);
 
 namespace Phalcon\Test\Unit\Config\ConfigFactory;
 
+use Phalcon\Config;
 use Phalcon\Config\Adapter\Ini;
 use Phalcon\Config\Adapter\Yaml;
 use Phalcon\Config\ConfigFactory;
@@ -20,7 +21,9 @@ use Phalcon\Config\Exception;
 use Phalcon\Test\Fixtures\Traits\FactoryTrait;
 use UnitTester;
 
+use function cacheDir;
 use function dataDir;
+use function get_class;
 use function hash;
 
 use const PROJECT_PATH;
@@ -218,4 +221,37 @@ class LoadCest
 
         $I->assertEquals("/phalcon4/", $config2->phalcon->baseUri);
     }
+
+    /**
+     * Tests Phalcon\Config\ConfigFactory :: load() - cacheDir
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function configFactoryLoadCacheDir(UnitTester $I)
+    {
+        $I->wantToTest('Config\ConfigFactory - load() - cacheDir');
+
+        $factory = new ConfigFactory();
+        $options = [
+            'adapter'  => 'yaml',
+            'filePath' => dataDir('assets/config/config.yml'),
+            'cacheDir' => cacheDir(),
+        ];
+
+        $config = $factory->load($options);
+        $I->assertInstanceOf(Config::class, $config);
+        $I->assertNotInstanceOf(Yaml::class, $config);
+
+        $cacheFile = cacheDir(
+            'config-' . md5(serialize(['yaml', $options['filePath'], null])) . '.php'
+        );
+        $I->assertFileExists($cacheFile);
+
+        $cached = $factory->load($options);
+        $I->assertSame(get_class($config), get_class($cached));
+        $I->assertEquals($config->toArray(), $cached->toArray());
+
+        $I->safeDeleteFile($cacheFile);
+    }
 }
@@ -0,0 +1,128 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Crypt;
+
+use Phalcon\Crypt;
+use Phalcon\Crypt\Exception;
+use UnitTester;
+
+class EncryptManyCest
+{
+    /**
+     * Tests Phalcon\Crypt :: encryptMany()/decryptMany()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cryptEncryptMany(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - encryptMany()/decryptMany()');
+
+        $texts = [
+            'name'  => 'Phalcon',
+            'email' => 'team@phalcon.io',
+            'empty' => '',
+        ];
+
+        $ciphers = [
+            'AES-128-CBC',
+            'AES-128-CFB',
+            'AES-256-CTR',
+        ];
+
+        $crypt = new Crypt();
+        $crypt->useSigning(true);
+
+        foreach ($ciphers as $cipher) {
+            $crypt->setCipher($cipher);
+
+            $encrypted = $crypt->encryptMany($texts, '1234567890123456');
+
+            $I->assertEquals(
+                ['name', 'email', 'empty'],
+                array_keys($encrypted)
+            );
+
+            $I->assertEquals(
+                $crypt->decrypt($encrypted['name'], '1234567890123456'),
+                'Phalcon'
+            );
+
+            $I->assertEquals(
+                $texts,
+                $crypt->decryptMany($encrypted, '1234567890123456')
+            );
+        }
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: encryptMany()/decryptMany() - gcm
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cryptEncryptManyGcm(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - encryptMany()/decryptMany() - gcm');
+
+        $texts = [
+            'name'  => 'Phalcon',
+            'email' => 'team@phalcon.io',
+        ];
+
+        $ciphers = [
+            'aes-128-gcm',
+            'aes-128-ccm',
+        ];
+
+        $crypt = new Crypt();
+
+        foreach ($ciphers as $cipher) {
+            $crypt
+                ->setCipher($cipher)
+                ->setAuthData('abcd')
+                ->setKey('123456')
+            ;
+
+            /**
+             * Every text keeps its own authentication tag
+             */
+            $encrypted = $crypt->encryptMany($texts);
+
+            $I->assertEquals(
+                $texts,
+                $crypt->decryptMany($encrypted)
+            );
+        }
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: encryptMany() - empty key
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function cryptEncryptManyExceptionEmptyKey(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - encryptMany() - exception empty key');
+
+        $I->expectThrowable(
+            new Exception('Encryption key cannot be empty'),
+            function () {
+                $crypt = new Crypt();
+                $crypt->encryptMany(['Phalcon']);
+            }
+        );
+    }
+}
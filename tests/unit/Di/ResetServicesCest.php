@@ -0,0 +1,66 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Di;
+
+use Phalcon\Di;
+use Phalcon\Http\Response;
+use Phalcon\Mvc\Router;
+use UnitTester;
+
+class ResetServicesCest
+{
+    /**
+     * Unit Tests Phalcon\Di :: resetServices()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function diResetServices(UnitTester $I)
+    {
+        $I->wantToTest('Di - resetServices()');
+
+        $container = new Di();
+
+        $container->setShared('response', Response::class);
+        $container->setShared(
+            'router',
+            function () {
+                $router = new Router(false);
+                $router->add('/', 'Index::index');
+
+                return $router;
+            }
+        );
+
+        // not resolved yet
+        $container->resetServices();
+
+        $response = $container->get('response');
+        $response->setContent('content');
+        $response->setHeader('X-Test', 'yes');
+
+        $router = $container->get('router');
+        $router->handle('/');
+
+        $I->assertTrue($router->wasMatched());
+
+        $container->resetServices();
+
+        $I->assertSame($response, $container->get('response'));
+        $I->assertEmpty($response->getContent());
+        $I->assertFalse($response->getHeaders()->get('X-Test'));
+        $I->assertFalse($router->wasMatched());
+        $I->assertCount(1, $router->getRoutes());
+    }
+}
@@ -0,0 +1,59 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Escaper;
+
+use Phalcon\Escaper;
+use UnitTester;
+
+class AttributesCest
+{
+    /**
+     * Tests Phalcon\Escaper :: attributes()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function escaperAttributes(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - attributes()');
+
+        $escaper = new Escaper();
+
+        $I->assertEquals(
+            ' class="a&quot;b" data-x="&lt;&amp;&gt;" title="plain"',
+            $escaper->attributes(
+                [
+                    'class'  => 'a"b',
+                    'id'     => null,
+                    0        => 'skipped',
+                    'data-x' => '<&>',
+                    'title'  => 'plain',
+                ]
+            )
+        );
+
+        $I->assertEquals(
+            '',
+            $escaper->attributes([])
+        );
+
+        $I->assertFalse(
+            $escaper->attributes(
+                [
+                    'class' => ['a', 'b'],
+                ]
+            )
+        );
+    }
+}
@@ -53,4 +53,37 @@ class EscapeHtmlCest
             $escaper->escapeHtml(null)
         );
     }
+
+    /**
+     * Tests Phalcon\Escaper :: escapeHtml() - fast path
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function escaperEscapeHtmlFastPath(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - escapeHtml() - fast path');
+
+        $escaper = new Escaper();
+
+        $I->assertEquals(
+            'Nothing to escape in this sentence',
+            $escaper->escapeHtml('Nothing to escape in this sentence')
+        );
+
+        $I->assertEquals(
+            'Nothing to escape until the end &amp; &quot;here&quot;',
+            $escaper->escapeHtml('Nothing to escape until the end & "here"')
+        );
+
+        $I->assertEquals(
+            'CafÃ© &lt;b&gt;',
+            $escaper->escapeHtml("Caf\xc3\xa9 <b>")
+        );
+
+        $I->assertEquals(
+            '',
+            $escaper->escapeHtml("invalid \xc3\x28 utf-8")
+        );
+    }
 }
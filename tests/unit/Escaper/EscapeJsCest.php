@@ -53,4 +53,32 @@ class EscapeJsCest
             $escaper->escapeJs($source)
         );
     }
+
+    /**
+     * Tests Phalcon\Escaper :: escapeJs() - UTF-8
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function escaperEscapeJsUtf8(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - escapeJs() - UTF-8');
+
+        $escaper = new Escaper();
+
+        $I->assertEquals(
+            'plain text',
+            $escaper->escapeJs('plain text')
+        );
+
+        $I->assertEquals(
+            'caf\\xe9 \\x20ac \\x1f600',
+            $escaper->escapeJs("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80")
+        );
+
+        $I->assertEquals(
+            'caf\\xe9',
+            $escaper->escapeJs("caf\xe9")
+        );
+    }
 }
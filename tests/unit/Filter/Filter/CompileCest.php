@@ -0,0 +1,181 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Filter\Filter;
+
+use Phalcon\Filter\FilterFactory;
+use Phalcon\Filter\Pipeline;
+use UnitTester;
+
+use function is_array;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Filter :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function filterFilterCompile(UnitTester $I)
+    {
+        $I->wantToTest('Filter - compile()');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $pipeline = $filter->compile(['trim', 'striptags', 'lower']);
+
+        $I->assertInstanceOf(Pipeline::class, $pipeline);
+
+        $I->assertEquals(
+            'phalcon',
+            $pipeline->sanitize('  <b>PHALCON</b> ')
+        );
+
+        $I->assertEquals(
+            ['a' => 'one', 'b' => 'two', 3 => 'äöü'],
+            $pipeline->sanitize(
+                [
+                    'a' => ' <a href="a">ONE</a> ',
+                    'b' => '  <h1>Two</h1>',
+                    3   => '<p>ÄÖÜ</p>',
+                ]
+            )
+        );
+
+        $pipeline = $filter->compile(['trim', 'upper']);
+
+        $I->assertEquals(
+            ['ÄÖÜ'],
+            $pipeline->sanitize([' äöü '])
+        );
+    }
+
+    /**
+     * Tests Phalcon\Filter :: compile() - matches sanitize()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function filterFilterCompileMatchesSanitize(UnitTester $I)
+    {
+        $I->wantToTest('Filter - compile() - matches sanitize()');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $values = [
+            " \t<b>Phalcon</b> Framework\n",
+            '  12abc-3  ',
+            "it's <\"special\"> & \x01",
+            '',
+        ];
+
+        $chains = [
+            ['trim', 'striptags', 'lower'],
+            ['trim', 'alnum', 'upper'],
+            ['special', 'trim'],
+            ['trim', 'int'],
+            ['trim', 'int', 'absint'],
+            ['trim', 'replace' => ['a', 'b'], 'upper'],
+        ];
+
+        foreach ($chains as $chain) {
+            $pipeline = $filter->compile($chain);
+
+            foreach ($values as $value) {
+                $I->assertSame(
+                    $filter->sanitize($value, $chain),
+                    $pipeline->sanitize($value)
+                );
+            }
+
+            /**
+             * Arrays match the sanitizers applied one after the other to
+             * every element
+             */
+            $expected = $values;
+
+            foreach ($chain as $key => $sanitizer) {
+                $single = is_array($sanitizer) ? [$key => $sanitizer] : $sanitizer;
+
+                foreach ($expected as $index => $value) {
+                    $expected[$index] = $filter->sanitize($value, $single, true);
+                }
+            }
+
+            $I->assertSame(
+                $expected,
+                $filter->sanitize($values, $chain)
+            );
+
+            $I->assertSame(
+                $expected,
+                $pipeline->sanitize($values)
+            );
+        }
+    }
+
+    /**
+     * Tests Phalcon\Filter :: sanitize() - set() drops the compiled pipelines
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function filterFilterSanitizeArraySet(UnitTester $I)
+    {
+        $I->wantToTest('Filter - sanitize() - array - set()');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $I->assertSame(
+            ['phalcon'],
+            $filter->sanitize([' Phalcon '], ['trim', 'lower'])
+        );
+
+        $filter->set(
+            'lower',
+            function ($value) {
+                return 'custom:' . $value;
+            }
+        );
+
+        $I->assertSame(
+            ['custom:Phalcon'],
+            $filter->sanitize([' Phalcon '], ['trim', 'lower'])
+        );
+    }
+
+    /**
+     * Tests Phalcon\Filter :: compile() - mixed arrays fall back
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function filterFilterCompileMixedArray(UnitTester $I)
+    {
+        $I->wantToTest('Filter - compile() - mixed array');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $pipeline = $filter->compile(['int']);
+
+        $I->assertSame(
+            [12, 5, 0],
+            $pipeline->sanitize(['12abc', 5, null])
+        );
+    }
+}
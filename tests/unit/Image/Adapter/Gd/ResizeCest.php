@@ -112,4 +112,83 @@ class ResizeCest
 
         $I->safeDeleteFile('resize.png');
     }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: resize() - deferred
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function imageAdapterGdResizeDeferred(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - resize() - deferred');
+
+        $image = new Gd(
+            dataDir('assets/images/phalconphp.jpg'),
+            null,
+            null,
+            true
+        );
+
+        $I->assertTrue(
+            $image->isDeferred()
+        );
+
+        $image->crop(400, 200)->resize(200, 100);
+
+        $I->assertTrue(
+            $image->isDeferred()
+        );
+
+        $I->assertSame(200, $image->getWidth());
+        $I->assertSame(100, $image->getHeight());
+
+        $resource = $image->getImage();
+
+        $I->assertFalse(
+            $image->isDeferred()
+        );
+
+        $I->assertSame(200, imagesx($resource));
+        $I->assertSame(100, imagesy($resource));
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: crop() - deferred without a resize
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function imageAdapterGdResizeDeferredCropOnly(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - crop() - deferred without a resize');
+
+        $image = new Gd(
+            dataDir('assets/images/phalconphp.jpg'),
+            null,
+            null,
+            true
+        );
+
+        $image->crop(400, 300, 0, 0);
+
+        $resource = $image->getImage();
+
+        $I->assertSame(400, imagesx($resource));
+        $I->assertSame(300, imagesy($resource));
+
+        /**
+         * The same pixels as an image cropped right away
+         */
+        $expected = new Gd(
+            dataDir('assets/images/phalconphp.jpg')
+        );
+
+        $expected->crop(400, 300, 0, 0);
+
+        $I->assertSame(
+            imagecolorat($expected->getImage(), 399, 299),
+            imagecolorat($resource, 399, 299)
+        );
+    }
 }
@@ -0,0 +1,127 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Image\Cache;
+
+use Phalcon\Image\Adapter\Gd;
+use Phalcon\Image\Cache;
+use Phalcon\Image\Exception;
+use Phalcon\Test\Fixtures\Traits\GdTrait;
+use UnitTester;
+
+class GetPathCest
+{
+    use GdTrait;
+
+    /**
+     * Tests Phalcon\Image\Cache :: getPath()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function imageCacheGetPath(UnitTester $I)
+    {
+        $I->wantToTest('Image\Cache - getPath()');
+
+        $directory = outputDir('tests/image/cache');
+        $cache     = new Cache($directory);
+        $source    = dataDir('assets/images/phalconphp.jpg');
+        $chain     = [
+            ['resize', 200, 76],
+            ['crop', 100, 50],
+        ];
+
+        $path = $cache->getPath($source, $chain, 'png');
+
+        $I->assertFileExists($path);
+        $I->assertStringEndsWith('.png', $path);
+
+        $I->assertSame(
+            [100, 50],
+            array_slice(getimagesize($path), 0, 2)
+        );
+
+        // The stored image is returned as it is
+        $mtime = filemtime($path);
+
+        $I->assertSame(
+            $path,
+            $cache->getPath($source, $chain, 'png')
+        );
+
+        $I->assertSame($mtime, filemtime($path));
+
+        // The lock file is kept for the next requests
+        $I->assertFileExists($path . '.lock');
+
+        // A different chain or format is another image
+        $I->assertNotEquals(
+            $path,
+            $cache->getPath($source, [['resize', 200, 76]], 'png')
+        );
+
+        $I->assertNotEquals(
+            $path,
+            $cache->getPath($source, $chain, 'jpg')
+        );
+
+        $I->assertSame(
+            file_get_contents($path),
+            $cache->render($source, $chain, 'png')
+        );
+
+        $I->safeDeleteDirectory($directory);
+    }
+
+    /**
+     * Tests Phalcon\Image\Cache :: getPath() - modified images
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function imageCacheGetPathModifiedImage(UnitTester $I)
+    {
+        $I->wantToTest('Image\Cache - getPath() - modified images');
+
+        $directory = outputDir('tests/image/cache');
+        $cache     = new Cache($directory);
+        $source    = dataDir('assets/images/phalconphp.jpg');
+        $mask      = dataDir('assets/images/logo.png');
+
+        $path = $cache->getPath($source, [['mask', new Gd($mask)]], 'png');
+
+        $I->assertFileExists($path);
+
+        /**
+         * Images changed in memory, even the deferred ones that only
+         * recorded a resize, don't match their file
+         */
+        $images = [
+            (new Gd($mask))->blur(1),
+            (new Gd($mask, null, null, true))->resize(10, 10),
+        ];
+
+        foreach ($images as $image) {
+            $I->expectThrowable(
+                new Exception(
+                    'Image operations only accept images that were not modified after they were loaded'
+                ),
+                function () use ($cache, $source, $image) {
+                    $cache->getPath($source, [['mask', $image]], 'png');
+                }
+            );
+        }
+
+        $I->safeDeleteDirectory($directory);
+    }
+}
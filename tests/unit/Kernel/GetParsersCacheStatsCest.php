@@ -0,0 +1,48 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Kernel;
+
+use Phalcon\Kernel;
+use UnitTester;
+
+class GetParsersCacheStatsCest
+{
+    /**
+     * Tests Phalcon\Kernel :: getParsersCacheStats()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-03-20
+     */
+    public function kernelGetParsersCacheStats(UnitTester $I)
+    {
+        $I->wantToTest('Kernel - getParsersCacheStats()');
+
+        $stats = Kernel::getParsersCacheStats();
+
+        $I->assertEquals(
+            ['enabled', 'entries', 'bytes', 'limit', 'hits', 'misses'],
+            array_keys($stats)
+        );
+
+        $I->assertInternalType('bool', $stats['enabled']);
+        $I->assertInternalType('int', $stats['hits']);
+
+        /**
+         * The counters are not INI entries anymore
+         */
+        $I->assertFalse(
+            ini_get('phalcon.parsers.cache_hits')
+        );
+    }
+}